@@ -9,7 +9,8 @@
 #undef strtoull
 #endif
 
-#include "..\..\shared\json\json.hpp"
+#include "../../shared/json/json.hpp"
+#include "../../shared/CsvScan.h"
 
 using json = nlohmann::json;
 
@@ -40,8 +41,13 @@ void readcsvparameter(qstring const &line, unsigned int &currIndex, T &param) {
                 currIndex++;
                 break;
             }
-            else
-                tmp.append(c);
+            else {
+                // append this character and all plain characters after it
+                unsigned int next = static_cast<unsigned int>(CsvScan::FindSpecial(line.c_str(), line.length(), currIndex + 1));
+                tmp.append(line.c_str() + currIndex, next - currIndex);
+                currIndex = next;
+                continue;
+            }
         }
         else {
             if (c != '"') {
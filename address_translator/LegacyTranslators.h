@@ -0,0 +1,533 @@
+#pragma once
+
+// Translators which were replaced by the range tables (shared\translators), kept unchanged except for the
+// 'legacy_' prefix. Used only by --self-test, which compares them with the tables for all 2^32 addresses.
+
+inline unsigned int legacy_translate_gtasa_10eu(unsigned int address) {
+    if (address == 0)
+        return address;
+    if (address >= 0x746720 && address < 0x857000) {
+        if (address >= 0x7BA940)
+            return address + 0x40;
+        return address + 0x50;
+    }
+    return address;
+}
+
+inline unsigned int legacy_translate_gtavc_11en(unsigned int address) {
+    if (address == 0)
+        return 0;
+    if (address < 0x489D0C)
+        return address;
+    else if (address < 0x489D10)
+        return address + 0x04;
+    else if (address < 0x489D82)
+        return address + 0x0D;
+    else if (address < 0x489E0D)
+        return address + 0x0E;
+    else if (address < 0x498FF3)
+        return address + 0x10;
+    else if (address < 0x4A4353)
+        return address + 0x21;
+    else if (address < 0x600FB0)
+        return address + 0x20;
+    else if (address < 0x601FF9) {
+        if (address < 0x601E83)
+            return address + 0x30;
+        else if (address < 0x601EAB)
+            return address + 0x2E;
+        else if (address < 0x601EAD)
+            return address + 0x2C;
+        else if (address < 0x601EDC)
+            return address + 0x30;
+        else if (address < 0x601EDE)
+            return address + 0x2E;
+        else if (address < 0x601F0E)
+            return address + 0x30;
+        else if (address < 0x601F10)
+            return address + 0x2E;
+        else if (address < 0x601F48)
+            return address + 0x30;
+        else if (address < 0x601F50)
+            return address + 0x2E;
+        else if (address < 0x601F5F)
+            return address + 0x28;
+        else if (address < 0x601F8C)
+            return address + 0x26;
+        else
+            return address + 0x24;
+    }
+    else if (address < 0x626F79)
+        return address - 0x20;
+    else if (address < 0x62758D) {
+        if (address < 0x626F7F)
+            return address - 0x1B;
+        else if (address < 0x6271C9)
+            return address - 0x20;
+        else if (address < 0x6271D8)
+            return address - 0x19;
+        else if (address < 0x6271ED)
+            return address - 0x20;
+        else if (address < 0x6271F7)
+            return address - 0x14;
+        else if (address < 0x627203)
+            return address - 0x02;
+        else if (address < 0x62720A)
+            return address + 0x20;
+        else if (address < 0x627214)
+            return address - 0x01;
+        else if (address < 0x62721B)
+            return address + 0x08;
+        else if (address < 0x6272DB)
+            return address + 0x0F;
+        else if (address < 0x6273D1)
+            return address + 0x10;
+        else if (address < 0x627448)
+            return address + 0x23;
+        else if (address < 0x627470)
+            return address + 0x28;
+        else if (address < 0x6274B6)
+            return address + 0x26;
+        else if (address < 0x6274CC)
+            return address + 0x2A;
+        else if (address < 0x627570)
+            return address + 0x20;
+        else
+            return address + 0x46;
+    }
+    else if (address < 0x67E000)
+        return address + 0x50;
+    else if (address < 0x6D6688)
+        return address;
+    else if (address < 0x6D6B28)
+        return address - 0x2C;
+    else if (address == 0x6DB8E8)
+        return 0x786D44;
+    else if (address < 0x6DB8F0)
+        return address - 0x28;
+    else if (address < 0x6DB924)
+        return address - 0x30;
+    else if (address < 0x6E0000)
+        return address - 0x10;
+    else if (address < 0x786BA8)
+        return address;
+    else if (address < 0x786D40)
+        return address + 0x04;
+    else if (address < 0xA10B56)
+        return address + 0x08;
+    else if (address < 0xA12000)
+        return address + 0x09;
+    else
+        return address;
+}
+
+inline unsigned int legacy_translate_gtavc_steam(unsigned int address) {
+    if (address == 0)
+        return 0;
+    if (address < 0x41CC07)
+        return address - 0x0;
+    else if (address < 0x41CC20)
+        return address - 0x37;
+    else if (address < 0x434730)
+        return address - 0x30;
+    else if (address < 0x435029)
+        return address - 0x40;
+    else if (address < 0x435040)
+        return address - 0x83;
+    else if (address < 0x443E00)
+        return address - 0x90;
+    else if (address < 0x4518D3)
+        return address - 0xF0;
+    else if (address < 0x4518E0)
+        return address - 0x124;
+    else if (address < 0x489D10)
+        return address - 0x120;
+    else if (address < 0x489D82)
+        return address - 0x113;
+    else if (address < 0x489E10)
+        return address - 0x112;
+    else if (address < 0x48E6FD)
+        return address - 0x110;
+    else if (address < 0x48E830)
+        return address - 0x10E;
+    else if (address < 0x48EC30)
+        return address - 0xF2;
+    else if (address < 0x498FF3)
+        return address - 0xF0;
+    else if (address < 0x49B993)
+        return address - 0xDF;
+    else if (address < 0x49BB91)
+        return address - 0xF6;
+    else if (address < 0x49BD00)
+        return address - 0x131;
+    else if (address < 0x4A4360)
+        return address - 0x141;
+    else if (address < 0x4A448A)
+        return address - 0x140;
+    else if (address < 0x4A4586)
+        return address - 0x18D;
+    else if (address < 0x4A4670)
+        return address - 0x186;
+    else if (address < 0x4A4734)
+        return address - 0x180;
+    else if (address < 0x4A47B0)
+        return address - 0x144;
+    else if (address < 0x4A4BE3)
+        return address - 0x140;
+    else if (address < 0x4A4CF3)
+        return address - 0x139;
+    else if (address < 0x4A4FD0)
+        return address - 0x133;
+    else if (address < 0x4C4230)
+        return address - 0x130;
+    else if (address < 0x516F87)
+        return address - 0x140;
+    else if (address < 0x517060)
+        return address - 0x111;
+    else if (address < 0x57BF40)
+        return address - 0x110;
+    else if (address < 0x5CC921)
+        return address - 0x1D0;
+    else if (address < 0x5CC9E0)
+        return address - 0x225;
+    else if (address < 0x5D7270)
+        return address - 0x230;
+    else if (address < 0x5D7A12)
+        return address - 0x2D0;
+    else if (address < 0x5D7A40)
+        return address - 0x3A2;
+    else if (address < 0x600FB0)
+        return address - 0x3A0;
+    else if (address < 0x602000)
+        return address - 0x390;
+    else if (address < 0x61D3D0)
+        return address - 0x3E0;
+    else if (address < 0x62121B)
+        return address - 0x3C0;
+    else if (address < 0x621230)
+        return address - 0x3AF;
+    else if (address < 0x626F80)
+        return address - 0x3B0;
+    else if (address < 0x62721B)
+        return address - 0x3B0;
+    else if (address < 0x6272E0)
+        return address - 0x381;
+    else if (address < 0x6274D0)
+        return address - 0x380;
+    else if (address < 0x627570)
+        return address - 0x370;
+    else if (address < 0x627590)
+        return address - 0x34A;
+    else if (address < 0x63762B)
+        return address - 0x340;
+    else if (address < 0x639268)
+        return address - 0x341;
+    else if (address < 0x67E000)
+        return address - 0x1050;
+    else if (address < 0x683000)
+        return address - 0x1000;
+    else if (address < 0x68DD7C)
+        return address - 0x1000;
+    else if (address < 0x69A020)
+        return address - 0xFF8;
+    else if (address < 0x69A0C8)
+        return address - 0x1004;
+    else if (address < 0x6A5580)
+        return address - 0x1000;
+    else if (address < 0x6A5740)
+        return address - 0x1004;
+    else if (address < 0x6D668C)
+        return address - 0x1008;
+    else if (address < 0x6D6B28)
+        return address - 0x1034;
+    else if (address < 0x6DB8F0)
+        return address - 0x1030;
+    else if (address < 0x6DB924)
+        return address - 0x1038;
+    else if (address < 0x6DCAE0)
+        return address - 0x1018;
+    else if (address < 0x6F23C0)
+        return address - 0x1068;
+    else if (address < 0x6F2434)
+        return address - 0x1008;
+    else if (address < 0x6F245C)
+        return address - 0x100C;
+    else if (address < 0x6F7000)
+        return address - 0x1010;
+    else if (address < 0x786BA8)
+        return address - 0x1000;
+    else if (address < 0x786D40)
+        return address - 0xFFC;
+    else if (address < 0xA10B20)
+        return address - 0xFF8;
+    else if (address < 0xA10B4E)
+        return address - 0xFF7;
+    else
+        return address - 0xFF6;
+}
+
+inline unsigned int legacy_translate_gta3_11en(unsigned int address) {
+    if (address == 0)
+        return 0;
+    // .bss
+    if (address >= 0x95CDAE)
+        return address + 0x1B8;
+    if (address == 0x95CDAD)
+        return 0x5FDB84;
+    if (address >= 0x95CD95)
+        return address + 0x1B9;
+    if (address >= 0x8F6000)
+        return address + 0x1B8;
+    if (address >= 0x8E2A6C)
+        return address + 0xB4;
+    if (address >= 0x8472E0)
+        return address - 0x50;
+    // .CRT
+    if (address >= 0x61C000)
+        return address;
+    // .data
+    if (address >= 0x618038)
+        return address - 0x938;
+    if (address >= 0x618034 && address < 0x618038)
+        return 0;
+    if (address >= 0x618030)
+        return address - 0x934;
+    if (address >= 0x617EAC)
+        return address - 0x948;
+    if (address >= 0x617DA4 && address < 0x617EAC)
+        return 0;
+    if (address >= 0x61167C)
+        return address - 0x840;
+    if (address >= 0x611574 && address < 0x61167C)
+        return 0;
+    if (address >= 0x602A60)
+        return address - 0x738;
+    if (address >= 0x602958 && address < 0x602A60)
+        return 0;
+    if (address >= 0x60269C)
+        return address - 0x630;
+    if (address >= 0x602698)
+        return address - 0x634;
+    if (address >= 0x60217C)
+        return address - 0x638;
+    if (address >= 0x602070 && address < 0x60217C)
+        return 0;
+    if (address >= 0x601E10)
+        return address - 0x530;
+    if (address >= 0x601D08 && address < 0x601E10)
+        return 0;
+    if (address >= 0x601CE8)
+        return address - 0x428;
+    if (address >= 0x601BE0 && address < 0x601CE8)
+        return 0;
+    if (address >= 0x6011A4)
+        return address - 0x320;
+    if (address >= 0x60109C && address < 0x6011A4)
+        return 0;
+    if (address >= 0x5FDDE0)
+        return address - 0x218;
+    if (address >= 0x5FDD9C)
+        return address - 0x214;
+    if (address >= 0x5F5714)
+        return address - 0x218;
+    if (address >= 0x5F560C && address < 0x5F5714)
+        return 0;
+    if (address >= 0x5F4C0C)
+        return address - 0x110;
+    if (address >= 0x5F4C08 && address < 0x5F4C0C)
+        return 0;
+    if (address >= 0x5F3F4C)
+        return address - 0x10C;
+    if (address >= 0x5F3F48 && address < 0x5F3F4C)
+        return 0;
+    if (address >= 0x5F0A58)
+        return address - 0x108;
+    if (address >= 0x5F094C && address < 0x5F0A58)
+        return 0;
+    // _rwcseg
+    if (address >= 0x5E4000)
+        return address;
+    // .text
+    if (address >= 0x5E3220)
+        return 0;
+    if (address >= 0x598B80)
+        return address + 0x2C0;
+    if (address >= 0x598B30)
+        return address + 0x280;
+    if (address >= 0x597560)
+        return address + 0x270;
+    if (address >= 0x597420)
+        return address + 0x280;
+    if (address >= 0x5973F0 && address < 0x597420)
+        return 0;
+    if (address >= 0x591910)
+        return address + 0x2B0;
+    if (address >= 0x590A00)
+        return address + 0x2C0;
+    if (address >= 0x5909D0 && address < 0x590A00)
+        return 0;
+    if (address >= 0x58B7A0)
+        return address + 0x2F0;
+    if (address >= 0x581460)
+        return address + 0x340;
+    if (address >= 0x566F50)
+        return address + 0x350;
+    if (address >= 0x566F20)
+        return address + 0x320;
+    if (address >= 0x566DC0)
+        return address + 0x310;
+    if (address >= 0x564D00)
+        return address + 0x140;
+    if (address >= 0x554FE0)
+        return address + 0x130;
+    if (address >= 0x554EA0)
+        return address + 0x140;
+    if (address >= 0x554E70 && address < 0x554EA0)
+        return 0;
+    if (address >= 0x554CA0)
+        return address + 0x170;
+    if (address >= 0x54E100)
+        return address + 0x140;
+    if (address >= 0x54E000)
+        return address + 0x150;
+    if (address >= 0x54DFD0 && address < 0x54E000)
+        return 0;
+    if (address >= 0x54A9B0)
+        return address + 0x180;
+    if (address >= 0x54A980)
+        return address + 0x190;
+    if (address >= 0x54A950 && address < 0x54A980)
+        return 0;
+    if (address >= 0x54A8A0)
+        return address + 0x1C0;
+    if (address >= 0x54A640)
+        return address + 0x1D0;
+    if (address >= 0x54A610 && address < 0x54A640)
+        return 0;
+    if (address >= 0x545760)
+        return address + 0x200;
+    if (address >= 0x5454D0)
+        return address + 0x210;
+    if (address >= 0x5454A0 && address < 0x5454D0)
+        return 0;
+    if (address >= 0x521770)
+        return address + 0x240;
+    if (address >= 0x518130)
+        return address + 0x230;
+    if (address >= 0x511B90)
+        return address + 0x210;
+    if (address >= 0x50D140)
+        return address + 0x1F0;
+    if (address >= 0x50B850)
+        return address + 0xF0;
+    if (address >= 0x4F6CE0)
+        return address + 0xE0;
+    if (address >= 0x4DD5D0)
+        return address + 0xB0;
+    if (address >= 0x4C1B50)
+        return address + 0xA0;
+    if (address >= 0x499890)
+        return address + 0xF0;
+    if (address >= 0x48DD60)
+        return address + 0xC0;
+    if (address >= 0x48DA50)
+        return address + 0xD0;
+    if (address >= 0x48DA20 && address < 0x48DA50)
+        return 0;
+    if (address >= 0x48C4B0)
+        return address + 0x100;
+    if (address >= 0x48AE60)
+        return address + 0xF0;
+    if (address >= 0x489270)
+        return address + 0x110;
+    if (address >= 0x488420)
+        return address + 0x100;
+    if (address >= 0x47F2B0)
+        return address + 0xD0;
+    if (address >= 0x47A440)
+        return address - 0x10;
+    if (address >= 0x4731C0)
+        return address;
+    if (address >= 0x46BEB0)
+        return address - 0x20;
+    if (address >= 0x46B1F0)
+        return address - 0x30;
+    if (address >= 0x46B100)
+        return address - 0x20;
+    if (address >= 0x46B0D0 && address < 0x46B100)
+        return 0;
+    if (address >= 0x461730)
+        return address + 0x10;
+    return address;
+}
+
+inline unsigned int legacy_translate_gta3_11en_to_steam(unsigned int address) {
+    if (address == 0)
+        return 0;
+
+    // .bss
+
+    if (address >= 0x663EC0)
+        return address + 0x10140;
+    // other RW data
+    if (address >= 0x661010)
+        return 0;
+    if (address >= 0x661010)
+        return address + 0x10010;
+    if (address >= 0x660FF8)
+        return address + 0xFF88;
+    if (address >= 0x660F78)
+        return address + 0x10020;
+    if (address >= 0x64C618)
+        return address + 0x10008;
+    if (address >= 0x621000)
+        return address + 0x10000;
+
+    // .data
+
+    // other RW data
+    if (address >= 0x618638)
+        return 0;
+    if (address >= 0x618520)
+        return address + 0xD000;
+    if (address >= 0x617A38)
+        return address + 0xCFF8;
+    if (address >= 0x6178F0)
+        return address + 0xCE08;
+    if (address >= 0x617700)
+        return address + 0xD140;
+    if (address >= 0x5F3E10)
+        return address + 0xCFF8;
+    if (address >= 0x5EA000)
+        return address + 0xD000;
+
+    // .text
+
+    // other RW functions
+    if (address >= 0x59E8B0)
+        return 0;
+    if (address >= 0x59CF50)
+        return address - 0x110;
+    if (address >= 0x59BC70)
+        return address - 0x2F10;
+    if (address >= 0x598E70)
+        return address + 0x11D0;
+    if (address >= 0x581FD0)
+        return address - 0x110;
+    if (address >= 0x567240)
+        return address - 0x100;
+    if (address >= 0x5670D0)
+        return address - 0x80;
+    if (address >= 0x53A090)
+        return address - 0x50;
+    if (address >= 0x48AF50)
+        return address - 0x70;
+    if (address >= 0x48AEE0 && address < 0x48AF50)
+        return 0;
+
+    return address;
+}
+
+inline unsigned int legacy_translate_gta3_steam(unsigned int address) {
+    return legacy_translate_gta3_11en_to_steam(legacy_translate_gta3_11en(address));
+}
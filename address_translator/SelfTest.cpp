@@ -0,0 +1,236 @@
+#include "SelfTest.h"
+#include "..\shared\translator.h"
+#include "LegacyTranslators.h"
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <random>
+#include <chrono>
+#include <thread>
+
+static string GetVersionTitle(Games::IDs game, unsigned int version) {
+    return "GTA " + Games::GetGameAbbr(game) + " " + Games::GetGameVersionName(game, version);
+}
+
+bool SelfTest::Run(unsigned int numBenchAddresses) {
+    // random addresses inside game executable
+    mt19937 rng(12345);
+    uniform_int_distribution<unsigned int> dist(0x400000, SweepEnd - 1);
+    vector<unsigned int> addrs(numBenchAddresses);
+    for (auto &a : addrs)
+        a = dist(rng);
+    unsigned int numFailed = CheckLegacy() ? 0 : 1;
+    for (unsigned int g = 0; g < 3; g++) {
+        Games::IDs game = Games::ToID(g);
+        for (unsigned int v = 1; v < Games::GetGameVersionsCount(game); v++) {
+            AddressRange const *ranges;
+            size_t numRanges;
+            if (!getAddrRanges(game, v, ranges, numRanges) || !ranges)
+                continue;
+            bool passed = CheckBatch(game, v, addrs);
+            passed = CheckRoundTrip(game, v) && passed;
+            if (passed)
+                Benchmark(game, v, addrs);
+            else
+                numFailed++;
+        }
+    }
+    if (numFailed) {
+        cout << "Self-test failed for " << numFailed << " check(s)" << endl;
+        return false;
+    }
+    cout << "Self-test passed" << endl;
+    return true;
+}
+
+bool SelfTest::CheckLegacy() {
+    struct Table {
+        char const *mName;
+        AddressRange const *mRanges;
+        size_t mNumRanges;
+        unsigned int(*mLegacy)(unsigned int);
+        unsigned long long mNumMismatches;
+        unsigned int mFirstMismatch;
+    };
+    Table tables[] = {
+        { "gtasa_10eu", gtasa_10eu_ranges, size(gtasa_10eu_ranges), legacy_translate_gtasa_10eu },
+        { "gtavc_11en", gtavc_11en_ranges, size(gtavc_11en_ranges), legacy_translate_gtavc_11en },
+        { "gtavc_steam", gtavc_steam_ranges, size(gtavc_steam_ranges), legacy_translate_gtavc_steam },
+        { "gta3_11en", gta3_11en_ranges, size(gta3_11en_ranges), legacy_translate_gta3_11en },
+        { "gta3_11en_to_steam", gta3_11en_to_steam_ranges, size(gta3_11en_to_steam_ranges), legacy_translate_gta3_11en_to_steam },
+        { "gta3_steam", gta3_steam_ranges.mRanges, size(gta3_steam_ranges.mRanges), legacy_translate_gta3_steam },
+    };
+    // one thread per table, each sweeps the whole address space
+    vector<thread> threads;
+    for (auto &table : tables) {
+        threads.emplace_back([&table] {
+            table.mNumMismatches = 0;
+            table.mFirstMismatch = 0;
+            unsigned int a = 0;
+            do {
+                if (translateAddrRanges(table.mRanges, table.mNumRanges, a) != table.mLegacy(a)) {
+                    if (table.mNumMismatches++ == 0)
+                        table.mFirstMismatch = a;
+                }
+            } while (++a != 0);
+        });
+    }
+    for (auto &t : threads)
+        t.join();
+    bool passed = true;
+    for (auto const &table : tables) {
+        cout << table.mName << ": legacy translator " << (table.mNumMismatches ? "FAILED" : "OK") << " (2^32 addresses, "
+            << table.mNumMismatches << " mismatches";
+        if (table.mNumMismatches)
+            cout << ", first at 0x" << hex << table.mFirstMismatch << dec;
+        cout << ")" << endl;
+        if (table.mNumMismatches)
+            passed = false;
+    }
+    return passed;
+}
+
+bool SelfTest::CheckBatch(Games::IDs game, unsigned int version, vector<unsigned int> const &addrs) {
+    vector<unsigned int> sorted = addrs;
+    sort(sorted.begin(), sorted.end());
+    vector<unsigned int> out(addrs.size());
+    // unsorted and sorted input take different paths in translateAddrRanges()
+    vector<unsigned int> const *inputs[] = { &addrs, &sorted };
+    for (auto input : inputs) {
+        translateAddrs(game, version, input->data(), out.data(), input->size());
+        for (size_t i = 0; i < input->size(); i++) {
+            if (out[i] != translateAddr(game, version, (*input)[i])) {
+                cout << GetVersionTitle(game, version) << ": translateAddrs() differs from translateAddr() for 0x"
+                    << hex << (*input)[i] << dec << endl;
+                return false;
+            }
+        }
+        untranslateAddrs(game, version, input->data(), out.data(), input->size());
+        for (size_t i = 0; i < input->size(); i++) {
+            if (out[i] != untranslateAddr(game, version, (*input)[i])) {
+                cout << GetVersionTitle(game, version) << ": untranslateAddrs() differs from untranslateAddr() for 0x"
+                    << hex << (*input)[i] << dec << endl;
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool SelfTest::CheckRoundTrip(Games::IDs game, unsigned int version) {
+    AddressRange const *ranges, *reverseRanges;
+    size_t numRanges, numReverseRanges;
+    getAddrRanges(game, version, ranges, numRanges);
+    getReverseAddrRanges(game, version, reverseRanges, numReverseRanges);
+    // addresses around range boundaries (the table is linear inside a range)
+    vector<unsigned int> boundaries = { 0xFFFFFFFE, 0xFFFFFFFF };
+    for (auto table : { make_pair(ranges, numRanges), make_pair(reverseRanges, numReverseRanges) }) {
+        for (size_t i = 0; i < table.second; i++) {
+            for (unsigned int d = 0; d < 5; d++) {
+                unsigned int a = table.first[i].mStart + d - 2;
+                if (a != 0)
+                    boundaries.push_back(a);
+            }
+        }
+    }
+    const size_t chunkSize = 0x10000;
+    vector<unsigned int> addrs(chunkSize), t(chunkSize), u(chunkSize), back(chunkSize);
+    unsigned long long numChecked = 0, numWithoutSource = 0;
+    unsigned int numErrors = 0;
+    const unsigned int maxErrorsToList = 10;
+    auto Error = [&](char const *what, unsigned int address, unsigned int result) {
+        if (numErrors++ < maxErrorsToList) {
+            cout << GetVersionTitle(game, version) << ": " << what << " (address 0x" << hex << address << ", result 0x" << result
+                << dec << ")" << endl;
+        }
+    };
+    auto Check = [&](size_t count) {
+        // forward: translate -> untranslate -> translate
+        translateAddrs(game, version, addrs.data(), t.data(), count);
+        untranslateAddrs(game, version, t.data(), u.data(), count);
+        translateAddrs(game, version, u.data(), back.data(), count);
+        for (size_t i = 0; i < count; i++) {
+            if (t[i] != 0 && (u[i] == 0 || back[i] != t[i]))
+                Error("translated address doesn't round trip", addrs[i], u[i]);
+        }
+        // reverse: untranslate -> translate
+        untranslateAddrs(game, version, addrs.data(), u.data(), count);
+        translateAddrs(game, version, u.data(), back.data(), count);
+        for (size_t i = 0; i < count; i++) {
+            if (u[i] == 0)
+                numWithoutSource++;
+            else if (back[i] != addrs[i])
+                Error("untranslated address is translated to other address", addrs[i], back[i]);
+        }
+        numChecked += count;
+    };
+    for (unsigned int start = 1; start < SweepEnd; start += chunkSize) {
+        size_t count = min<size_t>(chunkSize, SweepEnd - start);
+        for (size_t i = 0; i < count; i++)
+            addrs[i] = start + static_cast<unsigned int>(i);
+        Check(count);
+    }
+    for (size_t start = 0; start < boundaries.size(); start += chunkSize) {
+        size_t count = min<size_t>(chunkSize, boundaries.size() - start);
+        copy(boundaries.begin() + start, boundaries.begin() + start + count, addrs.begin());
+        Check(count);
+    }
+    cout << GetVersionTitle(game, version) << ": round trip " << (numErrors ? "FAILED" : "OK") << " (" << numChecked
+        << " addresses, " << numWithoutSource << " without source address, " << numErrors << " errors; " << numRanges
+        << " ranges, " << numReverseRanges << " reverse ranges)" << endl;
+    return numErrors == 0;
+}
+
+void SelfTest::Benchmark(Games::IDs game, unsigned int version, vector<unsigned int> const &addrs) {
+    if (addrs.empty())
+        return;
+    vector<unsigned int> sorted = addrs;
+    sort(sorted.begin(), sorted.end());
+    vector<unsigned int> out(addrs.size());
+    unsigned int checksum = 0;
+    // best of 3 runs, nanoseconds per address
+    auto Time = [&](auto run) {
+        double best = 0.0;
+        for (unsigned int i = 0; i < 3; i++) {
+            auto start = chrono::steady_clock::now();
+            run();
+            double ns = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / addrs.size();
+            if (i == 0 || ns < best)
+                best = ns;
+            checksum += out[out.size() / 2];
+        }
+        return best;
+    };
+    // lookup functions are called directly, so scalar calls can be inlined
+    auto TranslateScalar = [&](vector<unsigned int> const &in) {
+        return Time([&] {
+            for (size_t i = 0; i < in.size(); i++)
+                out[i] = translateAddr(game, version, in[i]);
+        });
+    };
+    auto UntranslateScalar = [&](vector<unsigned int> const &in) {
+        return Time([&] {
+            for (size_t i = 0; i < in.size(); i++)
+                out[i] = untranslateAddr(game, version, in[i]);
+        });
+    };
+    auto TranslateBatch = [&](vector<unsigned int> const &in) {
+        return Time([&] { translateAddrs(game, version, in.data(), out.data(), in.size()); });
+    };
+    auto UntranslateBatch = [&](vector<unsigned int> const &in) {
+        return Time([&] { untranslateAddrs(game, version, in.data(), out.data(), in.size()); });
+    };
+    double translateRandom = TranslateScalar(addrs), translateRandomBatch = TranslateBatch(addrs);
+    double translateSorted = TranslateScalar(sorted), translateSortedBatch = TranslateBatch(sorted);
+    double untranslateRandom = UntranslateScalar(addrs), untranslateRandomBatch = UntranslateBatch(addrs);
+    double untranslateSorted = UntranslateScalar(sorted), untranslateSortedBatch = UntranslateBatch(sorted);
+    cout << fixed << setprecision(1);
+    cout << GetVersionTitle(game, version) << ": ns per address (" << addrs.size() << " addresses, scalar -> batch)" << endl;
+    cout << "    translate random " << translateRandom << " -> " << translateRandomBatch
+        << ", sorted " << translateSorted << " -> " << translateSortedBatch << endl;
+    cout << "    untranslate random " << untranslateRandom << " -> " << untranslateRandomBatch
+        << ", sorted " << untranslateSorted << " -> " << untranslateSortedBatch << endl;
+    cout << defaultfloat;
+    if (checksum == 0x12345678) // results must be used
+        cout << endl;
+}
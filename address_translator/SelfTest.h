@@ -0,0 +1,24 @@
+#pragma once
+#include "..\shared\Games.h"
+#include <vector>
+
+using namespace std;
+
+// Check and benchmark of translation tables compiled into the tool (--self-test), results are printed to console.
+// Round trip: for each address 'a' which is translated to t != 0, untranslate(t) is translated to t again;
+// for each address 't' which is untranslated to u != 0, translate(u) == t. All addresses below SweepEnd
+// and the addresses around each range boundary (forward and reverse tables) are checked.
+// Batch translation (translateAddrs/untranslateAddrs) is compared with translateAddr/untranslateAddr,
+// then both are timed on 'numBenchAddresses' random and sorted addresses.
+// Each forward table is also compared with the translator it replaced (LegacyTranslators.h) for all 2^32 addresses.
+class SelfTest {
+public:
+    static const unsigned int SweepEnd = 0x1000000;
+
+    static bool Run(unsigned int numBenchAddresses);
+private:
+    static bool CheckLegacy();
+    static bool CheckRoundTrip(Games::IDs game, unsigned int version);
+    static bool CheckBatch(Games::IDs game, unsigned int version, vector<unsigned int> const &addrs);
+    static void Benchmark(Games::IDs game, unsigned int version, vector<unsigned int> const &addrs);
+};
@@ -0,0 +1,216 @@
+#include "TranslationTable.h"
+#include "..\shared\Utility.h"
+#include "..\shared\translator.h"
+#include "CSV.h"
+#include "StringEx.h"
+#include <fstream>
+#include <cstring>
+#include <cstdlib>
+#include <cstddef>
+
+// binary records are used as AddressRange array directly
+static_assert(sizeof(AddressRange) == 12 && offsetof(AddressRange, mOffset) == 4 && offsetof(AddressRange, mMapped) == 8,
+    "AddressRange layout doesn't match binary translation table format");
+static_assert(sizeof(TranslationTable::FileHeader) == 12, "Unexpected FileHeader size");
+
+static const char FileMagic[4] = { 'P', 'S', 'A', 'T' };
+
+bool TranslationTable::Load(path const &sdkpath, Games::IDs game, unsigned int version) {
+    mFile.reset();
+    mTextRanges.clear();
+    mRanges = nullptr;
+    mNumRanges = 0;
+    path binaryPath = GetFilePath(sdkpath, game, version, true);
+    path textPath = GetFilePath(sdkpath, game, version, false);
+    if (exists(binaryPath)) {
+        if (exists(textPath) && last_write_time(textPath) > last_write_time(binaryPath)) {
+            Message("Warning: %s is newer than %s (run with --build-table)", textPath.string().c_str(),
+                binaryPath.string().c_str());
+        }
+        mSupported = MapBinary(binaryPath);
+        return mSupported;
+    }
+    if (exists(textPath)) {
+        mSupported = ReadText(textPath, mTextRanges);
+        mRanges = mTextRanges.data();
+        mNumRanges = mTextRanges.size();
+        return mSupported;
+    }
+    // no table in database - use the one compiled into the tool
+    mSupported = getAddrRanges(game, version, mRanges, mNumRanges);
+    return true;
+}
+
+void TranslationTable::Translate(unsigned int const *in, unsigned int *out, size_t count) const {
+    if (!mSupported)
+        std::fill(out, out + count, 0);
+    else if (!mRanges) {
+        if (in != out)
+            std::copy(in, in + count, out);
+    }
+    else
+        translateAddrRanges(mRanges, mNumRanges, in, out, count);
+}
+
+path TranslationTable::GetFilePath(path const &sdkpath, Games::IDs game, unsigned int version, bool binary) {
+    return sdkpath / "database" / Games::GetGameFolder(game) / (string("plugin-sdk.") + Games::GetGameAbbrLow(game) +
+        ".translation." + Games::GetGameVersionName(game, version) + (binary ? ".bin" : ".txt"));
+}
+
+bool TranslationTable::MapBinary(path const &filepath) {
+    mFile = make_unique<MappedFile>(filepath);
+    if (!mFile->IsOpen())
+        return Message("Error: Unable to open translation table %s", filepath.string().c_str());
+    auto data = mFile->View();
+    FileHeader header;
+    if (data.size() < sizeof(FileHeader))
+        return Message("Error: Translation table %s is too small", filepath.string().c_str());
+    memcpy(&header, data.data(), sizeof(FileHeader));
+    if (memcmp(header.mMagic, FileMagic, sizeof(FileMagic)) || header.mFormatVersion != FormatVersion)
+        return Message("Error: %s is not a translation table (or has unsupported format version)", filepath.string().c_str());
+    if (data.size() != sizeof(FileHeader) + static_cast<size_t>(header.mNumRanges) * sizeof(AddressRange))
+        return Message("Error: Translation table %s has wrong size", filepath.string().c_str());
+    // bool values are checked before the records are read as AddressRange
+    char const *records = data.data() + sizeof(FileHeader);
+    for (unsigned int i = 0; i < header.mNumRanges; i++) {
+        unsigned char mapped = static_cast<unsigned char>(records[i * sizeof(AddressRange) + offsetof(AddressRange, mMapped)]);
+        if (mapped > 1)
+            return Message("Error: Translation table %s is damaged (range %d)", filepath.string().c_str(), static_cast<int>(i));
+    }
+    auto ranges = reinterpret_cast<AddressRange const *>(records);
+    if (!Validate(filepath, ranges, header.mNumRanges))
+        return false;
+    mRanges = ranges;
+    mNumRanges = header.mNumRanges;
+    return true;
+}
+
+bool TranslationTable::ReadText(path const &filepath, vector<AddressRange> &ranges) {
+    MappedFile file(filepath);
+    if (!file.IsOpen())
+        return Message("Error: Unable to open translation table %s", filepath.string().c_str());
+    auto lines = CSV::ReadLines(file);
+    for (size_t i = 0; i < lines.size(); i++) {
+        if (String::Trim(lines[i]).empty())
+            continue;
+        string csvStart, csvOffset;
+        CSV::Read(lines[i], csvStart, csvOffset);
+        String::Trim(csvStart);
+        String::Trim(csvOffset);
+        char *end = nullptr;
+        long long start = strtoll(csvStart.c_str(), &end, 0);
+        if (csvStart.empty() || *end || start < 0 || start > 0xFFFFFFFFll)
+            return Message("Error: Wrong range start '%s' (%s, line %d)", csvStart.c_str(), filepath.string().c_str(), static_cast<int>(i + 2));
+        AddressRange range = { static_cast<unsigned int>(start), 0, false };
+        if (csvOffset != "unmapped") {
+            long long offset = strtoll(csvOffset.c_str(), &end, 0);
+            if (csvOffset.empty() || *end || offset < -0x80000000ll || offset > 0x7FFFFFFFll)
+                return Message("Error: Wrong range offset '%s' (%s, line %d)", csvOffset.c_str(), filepath.string().c_str(), static_cast<int>(i + 2));
+            range.mOffset = static_cast<int>(offset);
+            range.mMapped = true;
+        }
+        ranges.push_back(range);
+    }
+    return Validate(filepath, ranges.data(), ranges.size());
+}
+
+bool TranslationTable::WriteText(path const &filepath, AddressRange const *ranges, size_t count) {
+    ofstream file(filepath.string());
+    if (!file.is_open())
+        return Message("Error: Unable to open %s", filepath.string().c_str());
+    file << "Start,Offset" << endl;
+    for (size_t i = 0; i < count; i++) {
+        file << String::Format("0x%X", ranges[i].mStart) << ",";
+        if (!ranges[i].mMapped)
+            file << "unmapped";
+        else if (ranges[i].mOffset < 0)
+            file << "-" << String::ToHexString(0u - static_cast<unsigned int>(ranges[i].mOffset));
+        else
+            file << String::ToHexString(ranges[i].mOffset);
+        file << endl;
+    }
+    file.close();
+    if (file.fail())
+        return Message("Error: Unable to write %s", filepath.string().c_str());
+    return true;
+}
+
+bool TranslationTable::WriteBinary(path const &filepath, AddressRange const *ranges, size_t count) {
+    ofstream file(filepath.string(), ios::binary);
+    if (!file.is_open())
+        return Message("Error: Unable to open %s", filepath.string().c_str());
+    FileHeader header;
+    memcpy(header.mMagic, FileMagic, sizeof(FileMagic));
+    header.mFormatVersion = FormatVersion;
+    header.mNumRanges = static_cast<unsigned int>(count);
+    file.write(reinterpret_cast<char const *>(&header), sizeof(FileHeader));
+    for (size_t i = 0; i < count; i++) {
+        // value-initialization zeroes the object with its padding bytes, so they are written as zeros
+        // ('record{}' is aggregate initialization, which doesn't guarantee that)
+        AddressRange record = AddressRange();
+        record.mStart = ranges[i].mStart;
+        record.mOffset = ranges[i].mOffset;
+        record.mMapped = ranges[i].mMapped;
+        file.write(reinterpret_cast<char const *>(&record), sizeof(AddressRange));
+    }
+    file.close();
+    if (file.fail())
+        return Message("Error: Unable to write %s", filepath.string().c_str());
+    return true;
+}
+
+bool TranslationTable::WriteHeader(path const &filepath, Games::IDs game, unsigned int version, AddressRange const *ranges,
+    size_t count)
+{
+    ofstream file(filepath.string());
+    if (!file.is_open())
+        return Message("Error: Unable to open %s", filepath.string().c_str());
+    string name = Games::GetGameFolder(game) + "_" + Games::GetGameVersionName(game, version);
+    file << "#pragma once" << endl;
+    file << "#include \"address_ranges.h\"" << endl;
+    file << endl;
+    file << "// Generated from " << GetFilePath("", game, version, false).filename().string() << endl;
+    file << endl;
+    file << "// GTA " << Games::GetGameAbbr(game) << " " << Games::GetGameVersionDetailedName(game, 0) << " -> "
+        << Games::GetGameVersionDetailedName(game, version) << " address ranges" << endl;
+    file << "inline constexpr AddressRange " << name << "_ranges[] = {" << endl;
+    for (size_t i = 0; i < count; i++) {
+        file << "    { " << String::Format("0x%06X", ranges[i].mStart) << ", ";
+        if (ranges[i].mOffset < 0)
+            file << "-" << String::ToHexString(0u - static_cast<unsigned int>(ranges[i].mOffset));
+        else
+            file << String::ToHexString(ranges[i].mOffset);
+        if (!ranges[i].mMapped)
+            file << ", false";
+        file << " }," << endl;
+    }
+    file << "};" << endl;
+    file << endl;
+    file << "inline unsigned int translate_" << name << "(unsigned int address) {" << endl;
+    file << "    return translateAddrRanges(" << name << "_ranges, address);" << endl;
+    file << "}" << endl;
+    file << endl;
+    file << "// GTA " << Games::GetGameAbbr(game) << " " << Games::GetGameVersionDetailedName(game, version) << " -> "
+        << Games::GetGameVersionDetailedName(game, 0) << ": reverse table" << endl;
+    file << "inline constexpr size_t " << name << "_reverse_count = countInvertedAddrRanges(" << name << "_ranges);" << endl;
+    file << "inline constexpr auto " << name << "_reverse_ranges = invertAddrRanges<" << name << "_reverse_count>("
+        << name << "_ranges);" << endl;
+    file << endl;
+    file << "inline unsigned int untranslate_" << name << "(unsigned int address) {" << endl;
+    file << "    return translateAddrRanges(" << name << "_reverse_ranges.mRanges, address);" << endl;
+    file << "}" << endl;
+    file.close();
+    if (file.fail())
+        return Message("Error: Unable to write %s", filepath.string().c_str());
+    return true;
+}
+
+bool TranslationTable::Validate(path const &filepath, AddressRange const *ranges, size_t count) {
+    if (count == 0 || ranges[0].mStart != 0)
+        return Message("Error: Translation table %s must start at address 0", filepath.string().c_str());
+    for (size_t i = 1; i < count; i++) {
+        if (ranges[i].mStart <= ranges[i - 1].mStart)
+            return Message("Error: Ranges in translation table %s are not sorted (range %d)", filepath.string().c_str(), static_cast<int>(i));
+    }
+    return true;
+}
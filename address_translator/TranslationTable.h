@@ -0,0 +1,54 @@
+#pragma once
+#include "..\shared\Games.h"
+#include "..\shared\translators\address_ranges.h"
+#include "MappedFile.h"
+#include <filesystem>
+#include <memory>
+#include <vector>
+
+using namespace std;
+using namespace std::experimental::filesystem;
+
+// Translation table of a game version, stored in database/<game>/plugin-sdk.<abbr>.translation.<version>.txt/.bin
+// (for example database/gtasa/plugin-sdk.sa.translation.11us.txt), so versions can be added without rebuilding the tools.
+// Text form (edited by hand):
+//     Start,Offset
+//     0x0,unmapped
+//     0x1,0
+//     0x489D0C,0x4
+//     0x5EA000,-0x70
+// Binary form (written with --build-table): FileHeader followed by AddressRange records, little-endian.
+// It is memory-mapped and used without copying.
+class TranslationTable {
+public:
+    struct FileHeader {
+        char mMagic[4];              // "PSAT"
+        unsigned int mFormatVersion; // FormatVersion
+        unsigned int mNumRanges;
+    };
+    static const unsigned int FormatVersion = 1;
+
+    // loads the table for given version: binary file, text file or table compiled into the tool (in this order)
+    bool Load(path const &sdkpath, Games::IDs game, unsigned int version);
+    // same as translateAddrs() with loaded table
+    void Translate(unsigned int const *in, unsigned int *out, size_t count) const;
+    AddressRange const *GetRanges() const { return mRanges; }
+    size_t GetNumRanges() const { return mNumRanges; }
+    bool IsSupported() const { return mSupported; }
+
+    static path GetFilePath(path const &sdkpath, Games::IDs game, unsigned int version, bool binary);
+    static bool ReadText(path const &filepath, vector<AddressRange> &ranges);
+    static bool WriteText(path const &filepath, AddressRange const *ranges, size_t count);
+    static bool WriteBinary(path const &filepath, AddressRange const *ranges, size_t count);
+    // constexpr header, same form as headers in shared\translators
+    static bool WriteHeader(path const &filepath, Games::IDs game, unsigned int version, AddressRange const *ranges, size_t count);
+    static bool Validate(path const &filepath, AddressRange const *ranges, size_t count);
+private:
+    unique_ptr<MappedFile> mFile;
+    vector<AddressRange> mTextRanges;
+    AddressRange const *mRanges = nullptr; // nullptr - addresses are not changed
+    size_t mNumRanges = 0;
+    bool mSupported = false;
+
+    bool MapBinary(path const &filepath);
+};
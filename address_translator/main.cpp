@@ -1,16 +1,30 @@
 #include "..\shared\Utility.h"
 #include "..\shared\Games.h"
 #include "CSV.h"
+#include "MappedFile.h"
 #include "StringEx.h"
 #include "..\shared\translator.h"
+#include "TranslationTable.h"
+#include "SelfTest.h"
 #include <filesystem>
+#include <fstream>
+#include <vector>
 
 using namespace std::experimental::filesystem;
 
 // usage:
 //     address_translator %PLUGIN_SDK_DIR% gtasa 10eu
+// translation tables in database (see TranslationTable.h):
+//     address_translator %PLUGIN_SDK_DIR% gtasa 10eu --export-table        (table compiled into the tool -> .txt)
+//     address_translator %PLUGIN_SDK_DIR% gtasa 10eu --build-table         (.txt -> .bin)
+//     address_translator %PLUGIN_SDK_DIR% gtasa 10eu --gen-header <file.h> (.txt -> constexpr header)
+// check and benchmark of compiled tables (see SelfTest.h):
+//     address_translator --self-test [number of addresses for benchmark, 1000000 by default]
 
 int main(int argc, char *argv[]) {
+    if (argc >= 2 && string(argv[1]) == "--self-test")
+        return SelfTest::Run(argc > 2 ? String::ToNumber(argv[2]) : 1000000) ? 0 : 10;
+
     if (argc < 4)
         return ErrorCode(1, "Error: Not enough parameters (%d, expected 4)", argc);
     path sdkpath = argv[1]; // plugin-sdk folder;
@@ -43,21 +57,52 @@ int main(int argc, char *argv[]) {
     if (gameVer == -1)
         return ErrorCode(4, "Error: Unknown game version (%s)", gameVerStr.c_str());
     
+    string mode = argc > 4 ? argv[4] : "";
+    if (mode == "--export-table") {
+        AddressRange const *ranges;
+        size_t numRanges;
+        if (!getAddrRanges(game, gameVer, ranges, numRanges) || !ranges)
+            return ErrorCode(8, "Error: There's no translation table for %s %s", gameNameStr.c_str(), gameVerStr.c_str());
+        if (!TranslationTable::WriteText(TranslationTable::GetFilePath(sdkpath, game, gameVer, false), ranges, numRanges))
+            return 9;
+        return 0;
+    }
+    if (mode == "--build-table" || mode == "--gen-header") {
+        vector<AddressRange> ranges;
+        if (!TranslationTable::ReadText(TranslationTable::GetFilePath(sdkpath, game, gameVer, false), ranges))
+            return 8;
+        if (mode == "--build-table") {
+            if (!TranslationTable::WriteBinary(TranslationTable::GetFilePath(sdkpath, game, gameVer, true), ranges.data(), ranges.size()))
+                return 9;
+        }
+        else {
+            if (argc < 6)
+                return ErrorCode(1, "Error: Header file path is not specified");
+            if (!TranslationTable::WriteHeader(argv[5], game, gameVer, ranges.data(), ranges.size()))
+                return 9;
+        }
+        return 0;
+    }
+    if (!mode.empty())
+        return ErrorCode(1, "Error: Unknown option (%s)", mode.c_str());
+
+    TranslationTable table;
+    if (!table.Load(sdkpath, game, gameVer))
+        return 7;
+
     path dbGamePath = sdkpath / "database" / Games::GetGameFolder(game);
 
-    auto WriteReferenceFile = [=](bool bFunctions) {
+    auto WriteReferenceFile = [&](bool bFunctions) {
         string refType = bFunctions ? "functions" : "variables";
         path baseFilePath = dbGamePath / (string("plugin-sdk.") + Games::GetGameAbbrLow(game) + "." + refType + "." +
             Games::GetGameVersionName(game, 0) + ".csv");
 
-        std::ifstream baseFile(baseFilePath.string());
-        if (!baseFile.is_open())
+        MappedFile baseFile(baseFilePath);
+        if (!baseFile.IsOpen())
             return ErrorCode(5, "Error: Unable to open base file %s", baseFilePath.string().c_str());
 
         auto baseLines = CSV::ReadLines(baseFile);
 
-        baseFile.close();
-
         path refFilePath = dbGamePath / (string("plugin-sdk.") + Games::GetGameAbbrLow(game) + "." + refType + "." +
             Games::GetGameVersionName(game, gameVer) + ".csv");
 
@@ -70,21 +115,29 @@ int main(int argc, char *argv[]) {
             refFile << ",RefList";
         refFile << ",NameComment" << endl;
 
-        for (auto &line : baseLines) {
-            string csvAddr, csvModule, csvName, csvDemangledName, csvType, csvCC, csvRetType, csvParameters, csvIsConst, csvRefs;
+        // the whole address column is translated in one call
+        vector<string> csvAddrs(baseLines.size()), csvDemangledNames(baseLines.size());
+        vector<unsigned int> addrs(baseLines.size());
+        for (size_t i = 0; i < baseLines.size(); i++) {
+            string csvModule, csvName, csvType, csvCC, csvRetType, csvParameters, csvIsConst, csvRefs;
             if (bFunctions)
-                CSV::Read(line, csvAddr, csvModule, csvName, csvDemangledName, csvType, csvCC, csvRetType, csvParameters, csvIsConst, csvRefs);
+                CSV::Read(baseLines[i], csvAddrs[i], csvModule, csvName, csvDemangledNames[i], csvType, csvCC, csvRetType, csvParameters, csvIsConst, csvRefs);
             else
-                CSV::Read(line, csvAddr, csvModule, csvName, csvDemangledName);
-            refFile << csvAddr << ",";
-            int addr = String::ToNumber(csvAddr);
-            if (addr == 0)
+                CSV::Read(baseLines[i], csvAddrs[i], csvModule, csvName, csvDemangledNames[i]);
+            addrs[i] = String::ToNumber(csvAddrs[i]);
+        }
+        vector<unsigned int> refAddrs(addrs.size());
+        table.Translate(addrs.data(), refAddrs.data(), addrs.size());
+
+        for (size_t i = 0; i < baseLines.size(); i++) {
+            refFile << csvAddrs[i] << ",";
+            if (addrs[i] == 0)
                 refFile << "0";
             else
-                refFile << String::ToHexString(translateAddr(game, gameVer, addr));
+                refFile << String::ToHexString(refAddrs[i]);
             if (bFunctions)
                 refFile << ",";
-            refFile << "," << CSV::Value(csvDemangledName) << endl;
+            refFile << "," << CSV::Value(csvDemangledNames[i]) << endl;
         }
 
         refFile.close();
@@ -0,0 +1,57 @@
+#include "Arena.h"
+#ifdef _WIN32
+#include <Windows.h>
+#include <Psapi.h>
+#pragma comment(lib, "psapi.lib")
+#else
+#include <sys/resource.h>
+#endif
+
+atomic<unsigned long long> Arena::mNumHeapAllocations{ 0 };
+
+void *Arena::Allocate(size_t size, size_t alignment) {
+    lock_guard<mutex> lock(mMutex);
+    size_t padding = (alignment - reinterpret_cast<size_t>(mCurrent) % alignment) % alignment;
+    if (!mCurrent || padding + size > static_cast<size_t>(mEnd - mCurrent)) {
+        // alignment of new[] is enough for all model objects
+        size_t blockSize = size > BlockSize ? size : BlockSize;
+        mBlocks.emplace_back(new char[blockSize]);
+        mCurrent = mBlocks.back().get();
+        mEnd = mCurrent + blockSize;
+        padding = 0;
+    }
+    void *result = mCurrent + padding;
+    mCurrent += padding + size;
+    mNumAllocations++;
+    mNumBytes += size;
+    return result;
+}
+
+void Arena::WriteStats(ostream &stream) {
+    lock_guard<mutex> lock(mMutex);
+    stream << "Arena: " << mNumAllocations << " allocations, " << (mNumBytes / 1024) << " KB in "
+        << mBlocks.size() << " blocks" << endl;
+}
+
+void *Arena::AllocateHeap(size_t size) {
+    mNumHeapAllocations++;
+    return ::operator new(size);
+}
+
+void Arena::WriteHeapStats(ostream &stream) {
+    stream << "Heap list allocations: " << mNumHeapAllocations.load() << endl;
+}
+
+size_t Arena::GetPeakMemoryUsage() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return counters.PeakWorkingSetSize;
+    return 0;
+#else
+    rusage usage;
+    if (!getrusage(RUSAGE_SELF, &usage))
+        return static_cast<size_t>(usage.ru_maxrss) * 1024;
+    return 0;
+#endif
+}
@@ -0,0 +1,83 @@
+#pragma once
+#include <cstddef>
+#include <new>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <ostream>
+
+using namespace std;
+
+// Per-game memory arena for the object model. Memory is released all at once, when the arena
+// is destroyed, so arena allocations have stable addresses and freeing a node costs nothing.
+// Containers capture the arena that is active in the current thread when they are constructed.
+class Arena {
+    static const size_t BlockSize = 1024 * 1024;
+
+    vector<unique_ptr<char[]>> mBlocks;
+    char *mCurrent = nullptr;
+    char *mEnd = nullptr;
+    unsigned long long mNumAllocations = 0;
+    unsigned long long mNumBytes = 0;
+    mutex mMutex; // containers constructed in game thread may be filled from worker threads
+
+    static atomic<unsigned long long> mNumHeapAllocations;
+public:
+    Arena() = default;
+    Arena(Arena const &) = delete;
+    Arena &operator=(Arena const &) = delete;
+
+    void *Allocate(size_t size, size_t alignment);
+    void WriteStats(ostream &stream);
+
+    static void *AllocateHeap(size_t size);
+    static void WriteHeapStats(ostream &stream);
+    static size_t GetPeakMemoryUsage(); // peak working set/resident set size in bytes
+
+    static inline Arena *&Current() {
+        static thread_local Arena *current = nullptr;
+        return current;
+    }
+
+    // makes the arena active in the current thread until the scope ends
+    class Scope {
+        Arena *mPrevious;
+    public:
+        Scope(Arena *arena) : mPrevious(Current()) { Current() = arena; }
+        ~Scope() { Current() = mPrevious; }
+    };
+};
+
+template<typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+    using propagate_on_container_swap = true_type;
+
+    Arena *mArena;
+
+    ArenaAllocator() : mArena(Arena::Current()) {}
+    explicit ArenaAllocator(Arena *arena) : mArena(arena) {}
+    template<typename U>
+    ArenaAllocator(ArenaAllocator<U> const &rhs) : mArena(rhs.mArena) {}
+
+    T *allocate(size_t count) {
+        if (mArena)
+            return static_cast<T *>(mArena->Allocate(count * sizeof(T), alignof(T)));
+        return static_cast<T *>(Arena::AllocateHeap(count * sizeof(T)));
+    }
+
+    void deallocate(T *p, size_t) {
+        if (!mArena)
+            ::operator delete(p);
+    }
+
+    // copied containers use the arena of the current thread
+    ArenaAllocator select_on_container_copy_construction() const { return ArenaAllocator(); }
+
+    template<typename U>
+    bool operator==(ArenaAllocator<U> const &rhs) const { return mArena == rhs.mArena; }
+    template<typename U>
+    bool operator!=(ArenaAllocator<U> const &rhs) const { return mArena != rhs.mArena; }
+};
@@ -0,0 +1,367 @@
+#include "..\shared\Utility.h"
+#include "Bench.h"
+#include "Generator.h"
+#include "StringEx.h"
+#include "Paths.h"
+#include "Parallel.h"
+#include "Log.h"
+#include "CSV.h"
+#include "MappedFile.h"
+#include "Hash.h"
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <chrono>
+#include <ctime>
+
+bool Bench::Run(path const &sdkpath, Options const &options) {
+    if (options.mBenchStructs == 0 || options.mBenchDepth == 0)
+        return Message("Error: Wrong benchmark size (%u structs, depth %u)", options.mBenchStructs, options.mBenchDepth);
+    path dbPath = sdkpath / "database";
+    path markerPath = dbPath / "synthetic.txt";
+    if (exists(dbPath) && !exists(markerPath))
+        return Message("Error: '%s' was not created by the benchmark", dbPath.string().c_str());
+    remove_all(dbPath);
+    create_directories(dbPath);
+    ofstream(markerPath) << "synthetic database written by plugin-sdk-source-gen --bench" << endl;
+    unsigned int numRelations = WriteRelationsFile(dbPath / "module_relations.txt", options);
+    json games = json::array();
+    for (unsigned int i = 0; i < 3; i++) {
+        Games::IDs game = Games::ToID(i);
+        if (!WriteDatabase(sdkpath, game, options))
+            return Message("Error: Unable to write synthetic database for GTA %s", Games::GetGameAbbr(game).c_str());
+        // generator log is not printed, only the results
+        ostringstream generatorLog;
+        Log::SetStream(&generatorLog);
+        json result = RunGame(sdkpath, game, numRelations, options);
+        Log::SetStream(nullptr);
+        games.push_back(result);
+    }
+    json run;
+    run["time"] = static_cast<long long>(time(nullptr));
+    run["jobs"] = Parallel::GetNumThreads(options.mJobs);
+    run["structs"] = options.mBenchStructs;
+    run["depth"] = options.mBenchDepth;
+    run["functions"] = options.mBenchFunctions;
+    run["variables"] = options.mBenchVariables;
+    run["games"] = games;
+    return AddRun(sdkpath, run);
+}
+
+bool Bench::AddRun(path const &sdkpath, json const &run) {
+    // results of previous runs are kept, so they can be compared run to run
+    path resultsPath = Paths::GetBenchPath(sdkpath);
+    json results;
+    string content;
+    if (Generator::ReadFileContent(resultsPath, content))
+        results = json::parse(content, nullptr, false);
+    if (!results.is_object() || !results["runs"].is_array())
+        results["runs"] = json::array();
+    results["runs"].push_back(run);
+    ofstream resultsFile(resultsPath);
+    if (!resultsFile.is_open())
+        return Message("Error: Unable to write benchmark results (%s)", resultsPath.string().c_str());
+    resultsFile << results.dump(4) << endl;
+    cout << "Benchmark results were added to " << resultsPath << endl;
+    return true;
+}
+
+// CSV reader used before CSV::NextField: the line is copied from the file with getline(),
+// each field is built character by character
+static void ReadParamFromString(string const &line, unsigned int &currIndex, string &param) {
+    string tmp;
+    bool startedQuotes = false;
+    bool inQuotes = false;
+    while (currIndex < line.length()) {
+        auto c = line[currIndex];
+        if (c == '\r' || c == '\n') {
+            currIndex = line.length();
+            break;
+        }
+        if (!startedQuotes) {
+            if (c == '"')
+                startedQuotes = true;
+            else if (!inQuotes && c == ',') {
+                currIndex++;
+                break;
+            }
+            else
+                tmp += c;
+        }
+        else {
+            if (c != '"') {
+                inQuotes = !inQuotes;
+                if (!inQuotes && c == ',') {
+                    currIndex++;
+                    break;
+                }
+            }
+            startedQuotes = false;
+            tmp += c;
+        }
+        currIndex++;
+    }
+    param = tmp;
+    String::Trim(param);
+}
+
+bool Bench::RunCsv(path const &sdkpath, Options const &options) {
+    const unsigned int numFields = 14; // columns of functions file
+    path filepath = Paths::GetBenchCsvPath(sdkpath);
+    if (!WriteCsvFile(filepath, options.mBenchCsvRows))
+        return Message("Error: Unable to write synthetic csv file (%s)", filepath.string().c_str());
+    // all fields are read and hashed, both readers must give the same hash
+    auto ReadMapped = [&]() {
+        unsigned long long hash = Hash::Basis;
+        MappedFile file(filepath);
+        string buffer;
+        string fields[numFields];
+        for (string_view line : CSV::ReadLines(file)) {
+            size_t currIndex = 0;
+            for (auto &field : fields) {
+                field.assign(CSV::NextField(line, currIndex, buffer));
+                hash = Hash::Get(field, hash);
+            }
+        }
+        return hash;
+    };
+    auto ReadStream = [&]() {
+        unsigned long long hash = Hash::Basis;
+        ifstream file(filepath);
+        List<string> lines;
+        bool firstLine = true;
+        for (string line; getline(file, line);) {
+            if (!firstLine)
+                lines.push_back(line);
+            else
+                firstLine = false;
+        }
+        string fields[numFields];
+        for (string const &line : lines) {
+            unsigned int currIndex = 0;
+            for (auto &field : fields) {
+                ReadParamFromString(line, currIndex, field);
+                hash = Hash::Get(field, hash);
+            }
+        }
+        return hash;
+    };
+    // best of 5 runs, milliseconds
+    auto Time = [](auto read, unsigned long long &hash) {
+        double best = 0.0;
+        for (unsigned int i = 0; i < 5; i++) {
+            auto start = chrono::steady_clock::now();
+            hash = read();
+            double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+            if (i == 0 || ms < best)
+                best = ms;
+        }
+        return best;
+    };
+    unsigned long long streamHash = 0, mappedHash = 0;
+    double streamMs = Time(ReadStream, streamHash);
+    double mappedMs = Time(ReadMapped, mappedHash);
+    if (streamHash != mappedHash)
+        return Message("Error: CSV readers returned different fields (%s)", filepath.string().c_str());
+    cout << "CSV reader, " << options.mBenchCsvRows << " rows, " << file_size(filepath) << " bytes: getline + ReadParam "
+        << streamMs << " ms, MappedFile + NextField " << mappedMs << " ms" << endl;
+    json run;
+    run["time"] = static_cast<long long>(time(nullptr));
+    run["csvRows"] = options.mBenchCsvRows;
+    run["csvBytes"] = file_size(filepath);
+    run["csvStreamReaderSeconds"] = streamMs / 1000.0;
+    run["csvMappedReaderSeconds"] = mappedMs / 1000.0;
+    return AddRun(sdkpath, run);
+}
+
+bool Bench::WriteCsvFile(path const &filepath, unsigned int numRows) {
+    ofstream file(filepath);
+    if (!file.is_open())
+        return false;
+    // same columns as database functions file; every 8th row has quoted fields
+    file << "10us,Module,Name,DemangledName,Type,CC,RetType,Parameters,IsConst,RefsList,Comment,Priority,VTableIndex,ForceOverloaded" << endl;
+    for (unsigned int f = 0; f < numRows; f++) {
+        string structName = GetStructName(f % 1000);
+        string name = "Method" + to_string(f / 1000);
+        file << String::ToHexString(0x401000 + f * 0x10) << ',' << structName << ",?" << name << '@' << structName << "@@QAEXHM@Z,"
+            << structName << "::" << name << ",,thiscall,void," << structName << " *:this int:value float:scale,0,";
+        if (f % 8 == 0)
+            file << "\"0x" << hex << 0x500000 + f << ",0x" << 0x600000 + f << dec << "\",\"calls \"\"" << name << "\"\", see notes\"";
+        else
+            file << ',';
+        file << ",1,-1,0" << endl;
+    }
+    return true;
+}
+
+string Bench::GetStructName(unsigned int index) {
+    return "CBench" + to_string(index);
+}
+
+unsigned int Bench::GetVTableSize(unsigned int index, Options const &options) {
+    // structs form inheritance chains of 'depth' structs, every third chain is not polymorphic;
+    // the chain root has 4 virtual functions, each derived struct adds one more
+    if ((index / options.mBenchDepth) % 3 == 2)
+        return 0;
+    return 4 + index % options.mBenchDepth;
+}
+
+unsigned int Bench::WriteRelationsFile(path const &filepath, Options const &options) {
+    ofstream file(filepath);
+    file << "# synthetic relations: structs derived from chain root require the next chain root" << endl;
+    unsigned int numRelations = 0;
+    for (unsigned int i = options.mBenchDepth; i < options.mBenchStructs; i += options.mBenchDepth) {
+        file << GetStructName(i - options.mBenchDepth) << "^ = " << GetStructName(i) << endl;
+        numRelations++;
+    }
+    return numRelations;
+}
+
+bool Bench::WriteDatabase(path const &sdkpath, Games::IDs game, Options const &options) {
+    path gameDbPath = Paths::GetDatabaseDir(sdkpath, game);
+    create_directories(gameDbPath / "enums");
+    create_directories(gameDbPath / "structs");
+    unsigned int numStructs = options.mBenchStructs;
+    unsigned int depth = options.mBenchDepth;
+
+    // structs
+    unsigned int parentSize = 0;
+    for (unsigned int i = 0; i < numStructs; i++) {
+        string name = GetStructName(i);
+        unsigned int level = i % depth;
+        unsigned int vtableSize = GetVTableSize(i, options);
+        json members = json::array();
+        unsigned int offset = 0;
+        if (level > 0) {
+            members.push_back({ { "name", "base" }, { "type", GetStructName(i - 1) }, { "offset", 0 }, { "size", parentSize }, { "isBase", true } });
+            offset = parentSize;
+        }
+        else if (vtableSize > 0) {
+            members.push_back({ { "name", "vtable" }, { "type", "void *" }, { "offset", 0 }, { "size", 4 } });
+            offset = 4;
+        }
+        members.push_back({ { "name", "m_nValue" }, { "type", "int" }, { "offset", offset }, { "size", 4 } });
+        members.push_back({ { "name", "m_pNext" }, { "type", GetStructName((i + 7) % numStructs) + " *" }, { "offset", offset + 4 }, { "size", 4 } });
+        members.push_back({ { "name", "m_vPos" }, { "type", "float[3]" }, { "offset", offset + 8 }, { "size", 12 } });
+        offset += 20;
+        json j;
+        j["module"] = name;
+        j["name"] = name;
+        j["kind"] = "class";
+        j["size"] = offset;
+        j["alignment"] = 4;
+        j["vtableAddress"] = vtableSize > 0 ? 0x800000 + i * 0x10 : 0;
+        j["vtableSize"] = vtableSize;
+        j["members"] = members;
+        ofstream file(gameDbPath / "structs" / (name + ".json"));
+        if (!file.is_open())
+            return false;
+        file << j.dump(4) << endl;
+        parentSize = offset;
+    }
+
+    // functions: constructor, new virtual functions, then pairs of overloaded methods
+    string versionName = Games::GetGameVersionName(game, 0);
+    string filePrefix = "plugin-sdk." + Games::GetGameAbbrLow(game);
+    Vector<string> functionNames(options.mBenchFunctions);
+    ofstream functionsFile(gameDbPath / (filePrefix + ".functions." + versionName + ".csv"));
+    if (!functionsFile.is_open())
+        return false;
+    functionsFile << versionName << ",Module,Name,DemangledName,Type,CC,RetType,Parameters,IsConst,RefsList,Comment,Priority,VTableIndex,ForceOverloaded" << endl;
+    for (unsigned int f = 0; f < options.mBenchFunctions; f++) {
+        unsigned int i = f % numStructs;
+        unsigned int k = f / numStructs;
+        string structName = GetStructName(i);
+        unsigned int vtableSize = GetVTableSize(i, options);
+        unsigned int firstVirtual = (i % depth == 0) ? 0 : vtableSize - 1;
+        unsigned int numNewVirtuals = vtableSize > 0 ? vtableSize - firstVirtual : 0;
+        string name, parameters = structName + " *:this";
+        int vtableIndex = -1;
+        if (k == 0)
+            name = structName;
+        else if (k <= numNewVirtuals) {
+            vtableIndex = firstVirtual + k - 1;
+            name = "Virtual" + to_string(vtableIndex);
+        }
+        else {
+            unsigned int method = k - 1 - numNewVirtuals;
+            name = "Method" + to_string(method / 2);
+            parameters += (method % 2) ? " int:value float:scale" : " int:value";
+        }
+        functionNames[f] = structName + "::" + name;
+        functionsFile << String::ToHexString(0x401000 + f * 0x10) << ',' << structName << ",?" << name << '@' << structName << "@@" << f
+            << ',' << functionNames[f] << ",,thiscall,void," << parameters << ",0,,,1," << vtableIndex << ",0" << endl;
+    }
+
+    // variables: static members
+    Vector<string> variableNames(options.mBenchVariables);
+    ofstream variablesFile(gameDbPath / (filePrefix + ".variables." + versionName + ".csv"));
+    if (!variablesFile.is_open())
+        return false;
+    variablesFile << versionName << ",Module,Name,DemangledName,Type,RawType,Size,DefaultValues,Comment,IsReadOnly" << endl;
+    for (unsigned int v = 0; v < options.mBenchVariables; v++) {
+        string structName = GetStructName(v % numStructs);
+        variableNames[v] = structName + "::ms_nValue" + to_string(v / numStructs);
+        variablesFile << String::ToHexString(0xA00000 + v * 4) << ',' << structName << ",?ms_nValue@" << structName << "@@" << v
+            << ',' << variableNames[v] << ",int,,4,,,0" << endl;
+    }
+
+    // reference versions
+    for (unsigned int version = 1; version < Games::GetGameVersionsCount(game); version++) {
+        versionName = Games::GetGameVersionName(game, version);
+        ofstream refFunctionsFile(gameDbPath / (filePrefix + ".functions." + versionName + ".csv"));
+        ofstream refVariablesFile(gameDbPath / (filePrefix + ".variables." + versionName + ".csv"));
+        if (!refFunctionsFile.is_open() || !refVariablesFile.is_open())
+            return false;
+        refFunctionsFile << Games::GetGameVersionName(game, 0) << ',' << versionName << ",RefsList,Name" << endl;
+        for (unsigned int f = 0; f < options.mBenchFunctions; f++) {
+            refFunctionsFile << String::ToHexString(0x401000 + f * 0x10) << ',' << String::ToHexString(0x401000 + f * 0x10 + version * 0x40)
+                << ",," << functionNames[f] << endl;
+        }
+        refVariablesFile << Games::GetGameVersionName(game, 0) << ',' << versionName << ",Name" << endl;
+        for (unsigned int v = 0; v < options.mBenchVariables; v++) {
+            refVariablesFile << String::ToHexString(0xA00000 + v * 4) << ',' << String::ToHexString(0xA00000 + v * 4 + version * 0x40)
+                << ',' << variableNames[v] << endl;
+        }
+    }
+    return true;
+}
+
+json Bench::RunGame(path const &sdkpath, Games::IDs game, unsigned int numRelations, Options const &options) {
+    GameData data(game, options.mArena);
+    Arena::Scope arenaScope(data.mActiveArena);
+    json phases = json::array();
+    auto start = chrono::steady_clock::now();
+    auto AddPhase = [&](char const *name, size_t numEntities) {
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        double throughput = seconds > 0.0 ? numEntities / seconds : 0.0;
+        json phase;
+        phase["name"] = name;
+        phase["seconds"] = seconds;
+        phase["entities"] = numEntities;
+        phase["entitiesPerSecond"] = throughput;
+        phases.push_back(phase);
+        cout << "GTA " << Games::GetGameAbbr(game) << " " << name << ": " << seconds << " s, " << numEntities << " entities, "
+            << static_cast<unsigned long long>(throughput) << " entities/s" << endl;
+        start = chrono::steady_clock::now();
+    };
+    Generator::ReadGame(data.mModules, data.mSymbols, sdkpath, game, options);
+    size_t numStructs = 0, numEntities = 0;
+    for (auto const &m : data.mModules) {
+        numEntities += m.mEnums.size() + m.mFunctions.size() + m.mVariables.size();
+        for (auto const &s : m.mStructs)
+            numEntities += s.mFunctions.size() + s.mVariables.size();
+        numStructs += m.mStructs.size();
+    }
+    AddPhase("ReadGame", numStructs + numEntities);
+    Generator::UpdateModules(data.mModules, data.mSymbols, data.mGraph);
+    AddPhase("UpdateModules", numStructs);
+    Generator::ReadRelationsFile(sdkpath / "database" / "module_relations.txt", data.mSymbols, data.mGraph);
+    AddPhase("ReadRelationsFile", numRelations);
+    Generator::WriteModules(sdkpath, game, data.mModules, options);
+    AddPhase("WriteModules", data.mModules.size());
+    json result;
+    result["game"] = Games::GetGameFolder(game);
+    result["phases"] = phases;
+    return result;
+}
@@ -0,0 +1,28 @@
+#pragma once
+#include <string>
+#include <filesystem>
+#include "Options.h"
+#include "..\shared\Games.h"
+#include "..\shared\json\json.hpp"
+
+using namespace std;
+using namespace std::experimental::filesystem;
+using json = nlohmann::json;
+
+// Benchmark mode (--bench): writes synthetic database to <sdk>/database/<game>/, times the generation
+// phases on it and appends the results to <sdk>/generated/bench.json.
+// Only a folder created by the benchmark is overwritten (it contains database/synthetic.txt).
+// CSV benchmark (--bench-csv): writes synthetic functions file to <sdk>/generated/bench.functions.csv and times reading
+// all its fields with CSV::ReadLines/NextField and with the reader they replaced (getline and character-by-character fields).
+class Bench {
+public:
+    static bool Run(path const &sdkpath, Options const &options);
+    static bool RunCsv(path const &sdkpath, Options const &options);
+    static bool AddRun(path const &sdkpath, json const &run); // append results to bench.json
+    static bool WriteCsvFile(path const &filepath, unsigned int numRows);
+    static bool WriteDatabase(path const &sdkpath, Games::IDs game, Options const &options);
+    static unsigned int WriteRelationsFile(path const &filepath, Options const &options); // returns number of relations
+    static json RunGame(path const &sdkpath, Games::IDs game, unsigned int numRelations, Options const &options);
+    static string GetStructName(unsigned int index);
+    static unsigned int GetVTableSize(unsigned int index, Options const &options); // 0 - struct has no vtable
+};
@@ -1,11 +1,34 @@
 #include "CSV.h"
+#include "../shared/CsvScan.h"
 
-void CSV::ReadParam(string const &line, unsigned int &currIndex, string &param) {
-    string tmp;
+void CSV::ReadParam(string_view line, size_t &currIndex, string &param) {
+    string buffer;
+    param.assign(NextField(line, currIndex, buffer));
+}
+
+string_view CSV::NextField(string_view line, size_t &currIndex, string &buffer) {
+    // fast path - field without quotes is a part of the line
+    size_t start = currIndex;
+    currIndex = CsvScan::FindSpecial(line.data(), line.length(), currIndex);
+    if (currIndex == line.length())
+        return String::Trim(line.substr(start));
+    auto c = line[currIndex];
+    if (c == '\r' || c == '\n') {
+        auto result = line.substr(start, currIndex - start);
+        currIndex = line.length();
+        return String::Trim(result);
+    }
+    if (c == ',') {
+        auto result = line.substr(start, currIndex - start);
+        currIndex++;
+        return String::Trim(result);
+    }
+    // field with quotes is unquoted into the buffer
+    buffer.assign(line.data() + start, currIndex - start);
     bool startedQuotes = false;
     bool inQuotes = false;
     while (currIndex < line.length()) {
-        auto c = line[currIndex];
+        c = line[currIndex];
         if (c == '\r' || c == '\n') {
             currIndex = line.length();
             break;
@@ -17,8 +40,13 @@ void CSV::ReadParam(string const &line, unsigned int &currIndex, string &param)
                 currIndex++;
                 break;
             }
-            else
-                tmp += c;
+            else {
+                // copy this character and all plain characters after it
+                size_t next = CsvScan::FindSpecial(line.data(), line.length(), currIndex + 1);
+                buffer.append(line.data() + currIndex, next - currIndex);
+                currIndex = next;
+                continue;
+            }
         }
         else {
             if (c != '"') {
@@ -29,24 +57,35 @@ void CSV::ReadParam(string const &line, unsigned int &currIndex, string &param)
                 }
             }
             startedQuotes = false;
-            tmp += c;
+            buffer += c;
         }
         currIndex++;
     }
-    param = tmp;
-    String::Trim(param);
+    return String::Trim(string_view(buffer));
+}
+
+Vector<string_view> CSV::ReadLines(MappedFile const &file) {
+    return ReadLines(file.View());
 }
 
-List<string> CSV::ReadLines(ifstream &file) {
+Vector<string_view> CSV::ReadLines(string_view data) {
     // comments are not supported
     // empty lines are not ignored
-    List<string> result;
+    Vector<string_view> result;
     bool firstLine = true;
-    for (string line; getline(file, line);) {
+    size_t lineStart = 0;
+    while (lineStart < data.length()) {
+        size_t lineEnd = data.find('\n', lineStart);
+        if (lineEnd == string_view::npos)
+            lineEnd = data.length();
+        auto line = data.substr(lineStart, lineEnd - lineStart);
+        if (!line.empty() && line.back() == '\r')
+            line.remove_suffix(1);
         if (!firstLine)
             result.push_back(line);
         else
             firstLine = false;
+        lineStart = lineEnd + 1;
     }
     return result;
 }
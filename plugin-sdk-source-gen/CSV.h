@@ -1,25 +1,31 @@
 #pragma once
 #include "StringEx.h"
-#include <fstream>
+#include <string_view>
 #include "ListEx.h"
+#include "MappedFile.h"
 
 class CSV {
-    static void ReadParam(string const &line, unsigned int &currIndex, string &param);
+    static void ReadParam(string_view line, size_t &currIndex, string &param);
 
     template <typename First, typename... Rest>
-    static void ReadParam(string const &line, unsigned int &currIndex, First &firstParam, Rest&... otherParams) {
+    static void ReadParam(string_view line, size_t &currIndex, First &firstParam, Rest&... otherParams) {
         ReadParam(line, currIndex, firstParam);
         ReadParam(line, currIndex, otherParams...);
     }
 
 public:
     template<typename... ArgTypes>
-    static void Read(string const &line, ArgTypes&... args) {
-        unsigned int currentIndex = 0;
+    static void Read(string_view line, ArgTypes&... args) {
+        size_t currentIndex = 0;
         ReadParam(line, currentIndex, args...);
     }
 
-    static List<string> ReadLines(ifstream &file);
+    // get next field from the line; the result points into the line, or into 'buffer' if field has quotes
+    static string_view NextField(string_view line, size_t &currIndex, string &buffer);
+
+    // lines of the file, without the first (header) line; the result points into the file data
+    static Vector<string_view> ReadLines(MappedFile const &file);
+    static Vector<string_view> ReadLines(string_view data);
 
     static string Value(string const &value);
 };
@@ -0,0 +1,63 @@
+#pragma once
+#include <string>
+#include <string_view>
+#include <ostream>
+#include <type_traits>
+#include <cstring>
+
+using namespace std;
+
+// Output sink for generated code. Text is collected in a memory buffer and written to
+// the file at once; endl adds a newline without flushing. Newlines are stored as
+// text-mode ofstream writes them, so tellp() (used for comments alignment) gives the same positions.
+class CodeStream {
+    string mData;
+    unsigned int mNumNewLines = 0;
+
+    void Append(char const *str, size_t size) {
+#ifdef _WIN32
+        char const *end = str + size;
+        for (char const *nl; (nl = static_cast<char const *>(memchr(str, '\n', end - str))) != nullptr; str = nl + 1) {
+            mData.append(str, nl - str);
+            mData.append("\r\n", 2);
+        }
+        mData.append(str, end - str);
+#else
+        mData.append(str, size);
+#endif
+    }
+
+public:
+    CodeStream() {
+        mData.reserve(64 * 1024);
+    }
+
+    CodeStream &operator<<(string_view str) {
+        Append(str.data(), str.size());
+        return *this;
+    }
+
+    CodeStream &operator<<(char c) {
+        Append(&c, 1);
+        return *this;
+    }
+
+    template<typename T>
+    enable_if_t<is_integral_v<T> && !is_same_v<T, char> && !is_same_v<T, signed char> && !is_same_v<T, unsigned char>, CodeStream &>
+    operator<<(T value) {
+        return operator<<(to_string(value));
+    }
+
+    // endl - new line without flush
+    CodeStream &operator<<(ostream &(*manip)(ostream &)) {
+        if (manip == static_cast<ostream &(*)(ostream &)>(endl)) {
+            Append("\n", 1);
+            mNumNewLines++;
+        }
+        return *this;
+    }
+
+    size_t tellp() const { return mData.size(); }
+    string const &str() const { return mData; }
+    unsigned int GetNumNewLines() const { return mNumNewLines; }
+};
@@ -1,7 +1,7 @@
 #include "Comments.h"
 #include "StringEx.h"
 
-void WriteComment(ofstream &stream, string const &comment, tabs t, unsigned int pos) {
+void WriteComment(CodeStream &stream, string const &comment, tabs t, unsigned int pos) {
     if (comment.empty())
         return;
     auto lines = String::Split(comment, ";;");
@@ -2,9 +2,10 @@
 #include <string>
 #include <fstream>
 #include "Tabs.h"
+#include "CodeStream.h"
 #include "..\shared\Games.h"
 
 using namespace std;
 
-void WriteComment(ofstream &stream, string const &comment, tabs t, unsigned int pos);
+void WriteComment(CodeStream &stream, string const &comment, tabs t, unsigned int pos);
 std::string GetPluginSdkComment(Games::IDs game, bool isHeader);
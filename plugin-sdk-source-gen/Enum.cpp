@@ -9,7 +9,7 @@ string Enum::GetFullName() const {
     return mScope + "::" + mName;
 }
 
-void Enum::Write(ofstream &stream, tabs t) {
+void Enum::Write(CodeStream &stream, tabs t) {
     WriteComment(stream, mComment, t, 0);
     stream << t() << "enum" << ' ';
     if (mIsClass)
@@ -78,7 +78,7 @@ string GetNameForBitField(Enum &en, EnumMember &m) {
     return name;
 }
 
-void Enum::WriteBitfield(ofstream &stream, tabs t, bool isAnonymousMember) {
+void Enum::WriteBitfield(CodeStream &stream, tabs t, bool isAnonymousMember) {
     string bitFieldType;
     if (!mIsSigned)
         bitFieldType = "unsigned ";
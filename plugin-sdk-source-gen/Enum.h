@@ -2,6 +2,7 @@
 #include <string>
 #include <fstream>
 #include "Tabs.h"
+#include "CodeStream.h"
 #include "ListEx.h"
 
 using namespace std;
@@ -32,6 +33,6 @@ public:
     List<EnumMember> mMembers;
 
     string GetFullName() const; // combine name + scope
-    void Write(ofstream &stream, tabs t);
-    void WriteBitfield(ofstream &stream, tabs t, bool isAnonymousMember);
+    void Write(CodeStream &stream, tabs t);
+    void WriteBitfield(CodeStream &stream, tabs t, bool isAnonymousMember);
 };
@@ -50,7 +50,7 @@ string Function::NameForWrapper(Games::IDs game, bool definition, string const &
     return result;
 }
 
-void Function::WriteFunctionCall(ofstream &stream, tabs t, Games::IDs game, bool writeReturn, SpecialCall specialType,
+void Function::WriteFunctionCall(CodeStream &stream, tabs t, Games::IDs game, bool writeReturn, SpecialCall specialType,
     SpecialData specialData, bool wsFuncs)
 {
     bool noReturn = (mRetType.mIsVoid && mRetType.mPointers.empty()) || IsConstructor() || IsDestructor();
@@ -139,7 +139,7 @@ void Function::WriteFunctionCall(ofstream &stream, tabs t, Games::IDs game, bool
         stream << t() << "return " << mParameters[mRVOParamIndex].mName << ";" << endl;
 }
 
-void Function::WriteDefinition(ofstream &stream, tabs t, Games::IDs game, Flags flags) {
+void Function::WriteDefinition(CodeStream &stream, tabs t, Games::IDs game, Flags flags) {
     if (flags.Empty()) {
         stream << t() << "int " << AddrOfMacro(false) << " = ADDRESS_BY_VERSION(" << Addresses(game) << ");" << endl;
         stream << t() << "int " << AddrOfMacro(true) << " = GLOBAL_ADDRESS_BY_VERSION(" << Addresses(game) << ");";
@@ -155,12 +155,12 @@ void Function::WriteDefinition(ofstream &stream, tabs t, Games::IDs game, Flags
     stream << t() << "}";
 }
 
-void Function::WriteDeclaration(ofstream &stream, tabs t, Games::IDs game, Flags flags) {
+void Function::WriteDeclaration(CodeStream &stream, tabs t, Games::IDs game, Flags flags) {
     WriteComment(stream, mComment, t, 0);
     stream << t() << NameForWrapper(game, false, string(), flags.OverloadedWideStringFunc) << ";";
 }
 
-void Function::WriteMeta(ofstream &stream, tabs t, Games::IDs game) {
+void Function::WriteMeta(CodeStream &stream, tabs t, Games::IDs game) {
     stream << t() << String::ToUpper(GetSpecialMetaWord()) << "META_BEGIN";
     if (UsesOverloadedMetaMacro())
         stream << "_OVERLOADED";
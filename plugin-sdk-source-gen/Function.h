@@ -4,6 +4,7 @@
 #include "Type.h"
 #include "..\shared\Games.h"
 #include "Tabs.h"
+#include "CodeStream.h"
 #include "ListEx.h"
 
 // TODO: function parameter default value CVector:arg(CVector())
@@ -115,7 +116,6 @@ public:
     Usage mUsage = Usage::Default; // constructor/destructor/etc.
     int mVTableIndex = -1;         // function index in virtual table
     bool mIsVirtual = false;       // function is virtual (placed in virtual table)
-    bool mWrittenToSource = false; // a temporary flag to detect if we already written this function to source file
     bool mHasWSParameters = false; // do we have wide-string parameters
 
     Vector<FunctionParameter> mParameters;
@@ -128,11 +128,11 @@ public:
     ExeVersionInfo mVersionInfo[Games::GetMaxGameVersions()];
 
     string GetFullName() const; // combine name + scope
-    void WriteFunctionCall(ofstream &stream, tabs t, Games::IDs game, bool writeReturn = true,
+    void WriteFunctionCall(CodeStream &stream, tabs t, Games::IDs game, bool writeReturn = true,
         SpecialCall specialType = SpecialCall::None, SpecialData specialData = SpecialData(), bool wsFunc = false);
-    void WriteDefinition(ofstream &stream, tabs t, Games::IDs game, Flags flags = Flags());
-    void WriteDeclaration(ofstream &stream, tabs t, Games::IDs game, Flags flags = Flags());
-    void WriteMeta(ofstream &stream, tabs t, Games::IDs game);
+    void WriteDefinition(CodeStream &stream, tabs t, Games::IDs game, Flags flags = Flags());
+    void WriteDeclaration(CodeStream &stream, tabs t, Games::IDs game, Flags flags = Flags());
+    void WriteMeta(CodeStream &stream, tabs t, Games::IDs game);
     string NameForWrapper(Games::IDs game, bool definition, string const &customName = string(), bool wsFuncs = false);
     string MetaDesc();
     string AddrOfMacro(bool global);
@@ -3,15 +3,12 @@
 #include "Paths.h"
 #include "Comments.h"
 #include "StringEx.h"
-#include <fstream>
+#include "OutputFile.h"
+#include "CodeStream.h"
 
 bool GameVersions::GenerateMacroFile(path const &sdkpath, Games::IDs game) {
     path filePath = Paths::GetOtherDir(sdkpath, game) / "VersionsMacro.h";
-    ofstream stream(filePath);
-    if (!stream.is_open()) {
-        Message("Unable to open VersionsMacro file '%s'", filePath.string().c_str());
-        return false;
-    }
+    CodeStream stream;
     stream << GetPluginSdkComment(game, true) << endl;
     stream << "#pragma once" << endl << endl;
     // how many combinations do we have
@@ -54,5 +51,9 @@ bool GameVersions::GenerateMacroFile(path const &sdkpath, Games::IDs game) {
 
         stream << "#endif" << endl;
     }
+    if (OutputFile::Write(filePath, stream.str()) == OutputFile::Result::Error) {
+        Message("Unable to write VersionsMacro file '%s'", filePath.string().c_str());
+        return false;
+    }
     return true;
 }
@@ -3,563 +3,1074 @@
 #include "JsonIO.h"
 #include "StringEx.h"
 #include "CSV.h"
+#include "MappedFile.h"
 #include "Paths.h"
+#include "Log.h"
+#include "Parallel.h"
+#include "Hash.h"
+#include "Manifest.h"
+#include "Snapshot.h"
+#include "Trace.h"
 #include <fstream>
 #include <iostream>
+#include <sstream>
+#include <mutex>
+#include <thread>
+#include <chrono>
+#include <algorithm>
 
-void Generator::Generate(path const &sdkpath) {
-    for (unsigned int i = 0; i < 3; i++) {
-        List<Module> modules;
-        cout << "Reading GTA " << Games::GetGameAbbr(Games::ToID(i)) << endl;
-        ReadGame(modules, sdkpath, Games::ToID(i));
-        cout << "Updating modules" << endl;
-        UpdateModules(modules);
-        cout << "Reading relations file" << endl;
-        ReadRelationsFile(sdkpath / "database" / "module_relations.txt", modules);
-        cout << "Writing modules for GTA " << Games::GetGameAbbr(Games::ToID(i)) << endl;
-        WriteModules(sdkpath, Games::ToID(i), modules);
+void WriteRunStats(ostream &stream) {
+    Type::WriteCacheStats(stream);
+    Arena::WriteHeapStats(stream);
+    stream << "Peak memory usage: " << (Arena::GetPeakMemoryUsage() / 1024) << " KB" << endl;
+}
+
+void Generator::Generate(path const &sdkpath, Options const &options) {
+    const unsigned int numGames = 3;
+    if (options.mPipeline) {
+        GeneratePipelined(sdkpath, options);
+        return;
+    }
+    if (Parallel::GetNumThreads(options.mJobs) <= 1) {
+        for (unsigned int i = 0; i < numGames; i++)
+            GenerateGame(sdkpath, Games::ToID(i), options);
+        if (options.mStats)
+            WriteRunStats(Log::Out());
+        return;
+    }
+    // create output folders before the threads are started
+    for (unsigned int i = 0; i < numGames; i++) {
+        Paths::GetDatabaseDir(sdkpath, Games::ToID(i));
+        Paths::GetModulesDir(sdkpath, Games::ToID(i));
+    }
+    // games don't share any data, so each game is processed in its own thread;
+    // the log is collected per game and printed when the game is finished
+    mutex outputMutex;
+    Parallel::For(numGames, options.mJobs, [&](size_t i) {
+        ostringstream gameLog;
+        Log::SetStream(&gameLog);
+        GenerateGame(sdkpath, Games::ToID(i), options);
+        Log::SetStream(nullptr);
+        lock_guard<mutex> lock(outputMutex);
+        cout << gameLog.str() << flush;
+    });
+    if (options.mStats)
+        WriteRunStats(cout);
+}
+
+// time spent by a pipeline stage thread on its work and on waiting for other stages
+class StageTimes {
+    chrono::steady_clock::time_point mLast = chrono::steady_clock::now();
+public:
+    chrono::steady_clock::duration mBusy{ 0 };
+    chrono::steady_clock::duration mIdle{ 0 };
+
+    void AddBusy() { mBusy += Next(); }
+    void AddIdle() { mIdle += Next(); }
+
+    chrono::steady_clock::duration Next() {
+        auto now = chrono::steady_clock::now();
+        auto result = now - mLast;
+        mLast = now;
+        return result;
+    }
+
+    void Write(ostream &stream, char const *stageName) {
+        stream << "Pipeline stage '" << stageName << "': busy "
+            << chrono::duration_cast<chrono::milliseconds>(mBusy).count() << " ms, idle "
+            << chrono::duration_cast<chrono::milliseconds>(mIdle).count() << " ms" << endl;
+    }
+};
+
+void Generator::GeneratePipelined(path const &sdkpath, Options const &options) {
+    const unsigned int numGames = 3;
+    for (unsigned int i = 0; i < numGames; i++) {
+        Paths::GetDatabaseDir(sdkpath, Games::ToID(i));
+        Paths::GetModulesDir(sdkpath, Games::ToID(i));
+    }
+    // each stage has its own thread: while one game is written, the next one is updated and the
+    // one after it is read. Modules of one game are not streamed between stages - derived structs
+    // complete vtables of their base classes and relations may refer to any module, so a module
+    // can be written only after all structs of the game were updated.
+    BoundedQueue<unique_ptr<GameData>> readQueue(1), updateQueue(1);
+    StageTimes readTimes, updateTimes, writeTimes;
+    thread reader([&] {
+        for (unsigned int i = 0; i < numGames; i++) {
+            auto data = make_unique<GameData>(Games::ToID(i), options.mArena);
+            Log::SetStream(&data->mLog);
+            ReadStage(sdkpath, *data, options);
+            Log::SetStream(nullptr);
+            readTimes.AddBusy();
+            readQueue.Push(move(data));
+            readTimes.AddIdle();
+        }
+        readQueue.Close();
+    });
+    thread updater([&] {
+        unique_ptr<GameData> data;
+        while (readQueue.Pop(data)) {
+            updateTimes.AddIdle();
+            Log::SetStream(&data->mLog);
+            UpdateStage(sdkpath, *data, options);
+            Log::SetStream(nullptr);
+            updateTimes.AddBusy();
+            updateQueue.Push(move(data));
+            updateTimes.AddIdle();
+        }
+        updateQueue.Close();
+    });
+    unique_ptr<GameData> data;
+    while (updateQueue.Pop(data)) {
+        writeTimes.AddIdle();
+        Log::SetStream(&data->mLog);
+        WriteStage(sdkpath, *data, options);
+        Log::SetStream(nullptr);
+        cout << data->mLog.str() << flush;
+        data.reset();
+        writeTimes.AddBusy();
     }
+    reader.join();
+    updater.join();
+    readTimes.Write(cout, "read");
+    updateTimes.Write(cout, "update");
+    writeTimes.Write(cout, "write");
+    if (options.mStats)
+        WriteRunStats(cout);
 }
 
-void Generator::ReadGame(List<Module> &modules, path const &sdkpath, Games::IDs game) {
+void Generator::GenerateGame(path const &sdkpath, Games::IDs game, Options const &options) {
+    GameData data(game, options.mArena);
+    ReadStage(sdkpath, data, options);
+    UpdateStage(sdkpath, data, options);
+    WriteStage(sdkpath, data, options);
+}
+
+void Generator::ReadStage(path const &sdkpath, GameData &data, Options const &options) {
+    Arena::Scope arenaScope(data.mActiveArena);
+    Games::IDs game = data.mGame;
+    Trace::Scope traceScope("game", "Read", "GTA " + Games::GetGameAbbr(game));
+    Log::Out() << "Reading GTA " << Games::GetGameAbbr(game) << endl;
+    if (options.mSnapshot) {
+        path snapshotPath = Paths::GetSnapshotPath(sdkpath, game);
+        unsigned long long snapshotKey = Snapshot::GetKey(GetInputFiles(sdkpath, game));
+        if (Snapshot::Load(snapshotPath, snapshotKey, data.mModules, data.mSymbols, game))
+            Log::Out() << "    Loaded snapshot " << snapshotPath << endl;
+        else {
+            ReadGame(data.mModules, data.mSymbols, sdkpath, game, options, data.mJsonCache);
+            if (!Snapshot::Save(snapshotPath, snapshotKey, data.mModules))
+                Log::Out() << "WARNING: Unable to write snapshot " << snapshotPath << endl;
+        }
+    }
+    else
+        ReadGame(data.mModules, data.mSymbols, sdkpath, game, options, data.mJsonCache);
+}
 
+void Generator::UpdateStage(path const &sdkpath, GameData &data, Options const &options) {
+    Arena::Scope arenaScope(data.mActiveArena);
+    Games::IDs game = data.mGame;
+    Trace::Scope traceScope("game", "Update", "GTA " + Games::GetGameAbbr(game));
+    Log::Out() << "Updating modules" << endl;
+    UpdateModules(data.mModules, data.mSymbols, data.mGraph);
+    if (options.mDumpGraph) {
+        if (!data.mGraph.WriteDot(Paths::GetGraphPath(sdkpath, game, ".dot"), game))
+            Log::Out() << "WARNING: Unable to write type graph " << Paths::GetGraphPath(sdkpath, game, ".dot") << endl;
+        if (!data.mGraph.WriteJson(Paths::GetGraphPath(sdkpath, game, ".json"), game))
+            Log::Out() << "WARNING: Unable to write type graph " << Paths::GetGraphPath(sdkpath, game, ".json") << endl;
+    }
+    Log::Out() << "Reading relations file" << endl;
+    ReadRelationsFile(sdkpath / "database" / "module_relations.txt", data.mSymbols, data.mGraph);
+}
+
+void Generator::WriteStage(path const &sdkpath, GameData &data, Options const &options) {
+    Arena::Scope arenaScope(data.mActiveArena);
+    Games::IDs game = data.mGame;
+    Trace::Scope traceScope("game", "Write", "GTA " + Games::GetGameAbbr(game));
+    Log::Out() << "Writing modules for GTA " << Games::GetGameAbbr(game) << endl;
+    WriteModules(sdkpath, game, data.mModules, options);
+    if (options.mStats) {
+        data.mSymbols.WriteStats(Log::Out());
+        data.mGraph.WriteStats(Log::Out());
+        if (options.mArena)
+            data.mArena.WriteStats(Log::Out());
+    }
+}
+
+Vector<path> Generator::GetJsonFiles(path const &folder) {
+    Vector<path> result;
+    for (const auto& p : recursive_directory_iterator(folder)) {
+        if (p.path().extension() == ".json")
+            result.push_back(p.path());
+    }
+    return result;
+}
+
+Vector<path> Generator::GetInputFiles(path const &sdkpath, Games::IDs game) {
     path gameDbPath = Paths::GetDatabaseDir(sdkpath, game);
+    auto files = GetJsonFiles(gameDbPath / "enums");
+    auto structFiles = GetJsonFiles(gameDbPath / "structs");
+    files.insert(files.end(), structFiles.begin(), structFiles.end());
+    for (unsigned int i = 0; i < Games::GetGameVersionsCount(game); i++) {
+        for (string type : { ".variables.", ".functions." })
+            files.push_back(gameDbPath / ("plugin-sdk." + Games::GetGameAbbrLow(game) + type + Games::GetGameVersionName(game, i) + ".csv"));
+    }
+    return files;
+}
+
+Module *Generator::FindOrAddModule(List<Module> &modules, SymbolTable &symbols, string const &name, Games::IDs game) {
+    Module *m = symbols.FindModule(name);
+    if (!m) {
+        Module &added = modules.emplace_back();
+        added.mName = name;
+        added.mGame = game;
+        symbols.AddModule(&added);
+        m = &added;
+    }
+    return m;
+}
+
+bool Generator::ReadFileContent(path const &filepath, string &content) {
+    ifstream file(filepath.string(), ios::binary);
+    if (!file.is_open())
+        return false;
+    ostringstream ss;
+    ss << file.rdbuf();
+    content = ss.str();
+    return true;
+}
+
+void Generator::ReadEnumFile(path const &filepath, Enum &e, unsigned long long &fileHash) {
+    string content;
+    if (!ReadFileContent(filepath, content))
+        return;
+    fileHash = Hash::Get(content);
+    // file may be incomplete if it is being written by another program (--watch)
+    json j = json::parse(content, nullptr, false);
+    if (j.is_discarded()) {
+        Log::Out() << "ERROR: Unable to parse " << filepath << endl;
+        return;
+    }
+    e.mModuleName = JsonIO::readJsonString(j, "module");
+    if (e.mModuleName.empty())
+        return;
+    e.mName = JsonIO::readJsonString(j, "name");
+    e.mScope = JsonIO::readJsonString(j, "scope");
+    e.mWidth = JsonIO::readJsonNumber(j, "width");
+    e.mIsClass = JsonIO::readJsonBool(j, "isClass");
+    e.mIsHexademical = JsonIO::readJsonBool(j, "isHexademical");
+    e.mIsSigned = JsonIO::readJsonBool(j, "isSigned");
+    e.mIsBitfield = JsonIO::readJsonBool(j, "isBitfield");
+    e.mIsAnonymous = JsonIO::readJsonBool(j, "isAnonymous");
+    e.mStartWord = JsonIO::readJsonString(j, "startWord");
+    e.mComment = JsonIO::readJsonString(j, "comment");
+    auto members = j.find("members");
+    if (members != j.end()) {
+        for (auto const &jm : *members) {
+            EnumMember m;
+            m.mName = JsonIO::readJsonString(jm, "name");
+            m.mValue = JsonIO::readJsonNumber(jm, "value");
+            m.mComment = JsonIO::readJsonString(jm, "comment");
+            m.mBitWidth = JsonIO::readJsonNumber(jm, "bitWidth");
+            e.mMembers.push_back(m);
+        }
+    }
+}
 
-    // read enums
-    for (const auto& p : recursive_directory_iterator(gameDbPath / "enums")) {
-        if (p.path().extension() == ".json") {
-            cout << "    Reading enum " << p.path() << endl;
-            ifstream enumFile(p.path().string());
-            if (enumFile.is_open()) {
-                json j = json::parse(enumFile);
-                string moduleName = JsonIO::readJsonString(j, "module");
-                if (!moduleName.empty()) {
-                    Module *m = Module::Find(modules, moduleName);
-                    if (!m) {
-                        Module tmp;
-                        tmp.mName = moduleName;
-                        tmp.mGame = game;
-                        modules.push_back(tmp);
-                        m = &modules.back();
+void Generator::ReadStructFile(path const &filepath, Struct &s, unsigned long long &fileHash) {
+    string content;
+    if (!ReadFileContent(filepath, content))
+        return;
+    fileHash = Hash::Get(content);
+    // file may be incomplete if it is being written by another program (--watch)
+    json j = json::parse(content, nullptr, false);
+    if (j.is_discarded()) {
+        Log::Out() << "ERROR: Unable to parse " << filepath << endl;
+        return;
+    }
+    s.mModuleName = JsonIO::readJsonString(j, "module");
+    if (s.mModuleName.empty())
+        return;
+    s.mName = JsonIO::readJsonString(j, "name");
+    s.mScope = JsonIO::readJsonString(j, "scope");
+    if (s.mName.rfind("::") != string::npos)
+        String::Break(s.mName, "::", s.mScope, s.mName, true);
+    string kind = JsonIO::readJsonString(j, "kind");
+    if (kind == "struct")
+        s.mKind = Struct::Kind::Struct;
+    else if (kind == "union")
+        s.mKind = Struct::Kind::Union;
+    else
+        s.mKind = Struct::Kind::Class;
+    s.mSize = JsonIO::readJsonNumber(j, "size");
+    s.mAlignment = JsonIO::readJsonNumber(j, "alignment");
+    s.mIsAnonymous = JsonIO::readJsonBool(j, "isAnonymous");
+    s.mIsCoreClass = JsonIO::readJsonBool(j, "isCoreClass");
+    s.mIsAbstractClass = JsonIO::readJsonBool(j, "isAbstract");
+    s.mHasVectorDeletingDestructor = JsonIO::readJsonBool(j, "hasVectorDeletingDtor");
+    s.mVTableAddress = JsonIO::readJsonNumber(j, "vtableAddress");
+    s.mHasVTable = s.mVTableAddress != 0;
+    s.mVTableSize = JsonIO::readJsonNumber(j, "vtableSize");
+    s.mComment = JsonIO::readJsonString(j, "comment");
+    auto members = j.find("members");
+    if (members != j.end()) {
+        for (auto const &jm : *members) {
+            StructMember m;
+            m.mName = JsonIO::readJsonString(jm, "name");
+            string fullType = JsonIO::readJsonString(jm, "rawType"); // read custom type
+            if (fullType.empty()) // if custom is not defined, read default type
+                fullType = JsonIO::readJsonString(jm, "type");
+            else
+                m.mType.mWasSetFromRawType = true;
+            m.mOffset = JsonIO::readJsonNumber(jm, "offset");
+            m.mSize = JsonIO::readJsonNumber(jm, "size");
+            bool isAnonymous = JsonIO::readJsonBool(jm, "isAnonymous");
+            bool isBaseClass = JsonIO::readJsonBool(jm, "isBase");
+            m.mIsBitfield = JsonIO::readJsonBool(jm, "isBitfield");
+            m.mComment = JsonIO::readJsonString(jm, "comment");
+            if (fullType.empty()) {
+                if (m.mSize == 1)
+                    fullType = "char";
+                else if (m.mSize == 2)
+                    fullType = "short";
+                else if (m.mSize == 4)
+                    fullType = "int";
+                else
+                    fullType = "char[" + to_string(m.mSize) + "]";
+            }
+            m.mType.SetFromString(fullType);
+            if (s.mParentName.empty() &&
+                (isBaseClass || m.mName == "base" || String::StartsWith(m.mName, "baseclass_")))
+            {
+                m.mIsBase = true;
+                s.mParentName = m.mType.mName;
+            }
+            if (isAnonymous || String::StartsWith(m.mName, "anonymous_"))
+                m.mIsAnonymous = true;
+            if (String::StartsWith(m.mName, "_pad") || String::StartsWith(m.mName, "__pad")) {
+                m.mName = "_pad" + String::ToHexString(m.mOffset, false);
+                m.mIsPadding = true;
+            }
+            if (!s.mHasVTableMember && m.mOffset == 0 && (m.mName == "vtable" || m.mName == "vftable" || m.mName == "vmt")) {
+                m.mIsVTable = true;
+                s.mHasVTableMember = true;
+            }
+            s.mMembers.push_back(m);
+        }
+    }
+}
+
+unordered_map<unsigned int, Variable *> Generator::BuildVariablesIndex(List<Module> &modules) {
+    // same order as Module::GetVariable() called for each module - the first variable wins
+    unordered_map<unsigned int, Variable *> index;
+    for (auto &m : modules) {
+        for (auto &v : m.mVariables)
+            index.emplace(v.mVersionInfo[0].mAddress, &v);
+        for (auto &s : m.mStructs) {
+            for (auto &sv : s.mVariables)
+                index.emplace(sv.mVersionInfo[0].mAddress, &sv);
+        }
+    }
+    return index;
+}
+
+unordered_map<unsigned int, Function *> Generator::BuildFunctionsIndex(List<Module> &modules) {
+    // same order as Module::GetFunction() called for each module - the first function wins
+    unordered_map<unsigned int, Function *> index;
+    for (auto &m : modules) {
+        for (auto &f : m.mFunctions)
+            index.emplace(f.mVersionInfo[0].mAddress, &f);
+        for (auto &s : m.mStructs) {
+            for (auto &sf : s.mFunctions)
+                index.emplace(sf.mVersionInfo[0].mAddress, &sf);
+        }
+    }
+    return index;
+}
+
+void Generator::ReportMissingAddresses(string const &entityType, Vector<unsigned int> const &addresses) {
+    if (addresses.empty())
+        return;
+    Log::Out() << "    WARNING: " << addresses.size() << " " << entityType << " address(es) not found in base version:";
+    const size_t maxAddressesToList = 10;
+    for (size_t i = 0; i < addresses.size() && i < maxAddressesToList; i++)
+        Log::Out() << " " << String::ToHexString(addresses[i]);
+    if (addresses.size() > maxAddressesToList)
+        Log::Out() << " ...";
+    Log::Out() << endl;
+}
+
+void Generator::AddInputHash(SymbolTable &symbols, string const &moduleName, string const &data) {
+    Module *m = symbols.FindModule(moduleName);
+    if (m)
+        m->AddInputHash(Hash::Get(data));
+}
+
+// parse json files in worker threads; with cache, files which were not changed since previous run are not parsed
+template<typename T>
+void ReadJsonFiles(Vector<path> const &files, Vector<T> &decoded, Vector<unsigned long long> &hashes, JsonFileCache::Map<T> *cache,
+    unsigned int &numParsed, Options const &options, void (*readFile)(path const &, T &, unsigned long long &)) {
+    Vector<size_t> filesToParse;
+    Vector<unsigned long long> stamps(files.size());
+    for (size_t i = 0; i < files.size(); i++) {
+        if (cache) {
+            stamps[i] = JsonFileCache::GetFileStamp(files[i]);
+            auto it = cache->find(files[i].string());
+            if (it != cache->end() && it->second.mStamp == stamps[i]) {
+                decoded[i] = it->second.mDecoded;
+                hashes[i] = it->second.mHash;
+                continue;
+            }
+        }
+        filesToParse.push_back(i);
+    }
+    Parallel::For(filesToParse.size(), options.mJobs, [&](size_t i) {
+        readFile(files[filesToParse[i]], decoded[filesToParse[i]], hashes[filesToParse[i]]);
+    });
+    numParsed += filesToParse.size();
+    if (cache) {
+        Arena::Scope heapScope(nullptr);
+        JsonFileCache::Map<T> updated;
+        for (size_t i = 0; i < files.size(); i++) {
+            string key = files[i].string();
+            auto it = cache->find(key);
+            if (it != cache->end() && it->second.mStamp == stamps[i])
+                updated[key] = move(it->second);
+            else
+                updated[key] = { stamps[i], hashes[i], decoded[i] };
+        }
+        cache->swap(updated);
+    }
+}
+
+bool Generator::ReadVariableLine(string_view csvLine, JsonFileCache::VariableLine &line) {
+    string varAddress, varModuleName, varName, varDemName, varType, varRawType, varSize, varDefaultValues, varComment, varIsReadOnly;
+    CSV::Read(csvLine, varAddress, varModuleName, varName, varDemName, varType, varRawType, varSize, varDefaultValues, varComment, varIsReadOnly);
+    if (varModuleName.empty())
+        return false;
+    line.mModuleName = varModuleName;
+    line.mHash = Hash::Get(csvLine);
+    // get variable type
+    string finalVarType = varRawType;
+    if (finalVarType.empty())
+        finalVarType = varType;
+    // if var type and var name are empty
+    if (finalVarType.empty() || varDemName.empty()) {
+        line.mWarning = String::Format("wrong variable '(%s) %s' (address %s)",
+            (finalVarType.empty()? "<no-type>" : finalVarType.c_str()),
+            (varDemName.empty() ? "<no-name>" : varDemName.c_str()), varAddress.c_str());
+        return true;
+    }
+    string varScope;
+    String::Break(varDemName, "::", varScope, varDemName, true);
+    Variable &newVar = line.mVariable;
+    newVar.mName = varDemName;
+    newVar.mMangledName = varName;
+    newVar.mModuleName = varModuleName;
+    newVar.mScope = varScope;
+    newVar.mDefaultValues = varDefaultValues;
+    newVar.mComment = varComment;
+    newVar.mType.SetFromString(finalVarType);
+    newVar.mSize = String::ToNumber(varSize);
+    newVar.mVersionInfo[0].mAddress = String::ToNumber(varAddress);
+    newVar.mIsReadOnly = String::ToNumber(varIsReadOnly);
+    return true;
+}
+
+bool Generator::ReadFunctionLine(string_view csvLine, JsonFileCache::FunctionLine &line) {
+    // 10us,Module,Name,DemangledName,Type,CC,RetType,Parameters,IsConst,Comment
+    string fnAddress, fnModuleName, fnName, fnDemName, fnType, fnCC, fnRetType, fnParameters, fnIsConst, 
+        fnRefsStr, fnComment, fnPriority, fnVTableIndex, fnForceOverloaded;
+    CSV::Read(csvLine, fnAddress, fnModuleName, fnName, fnDemName, fnType, fnCC, fnRetType, fnParameters,
+        fnIsConst, fnRefsStr, fnComment, fnPriority, fnVTableIndex, fnForceOverloaded);
+    if (fnModuleName.empty())
+        return false;
+    line.mModuleName = fnModuleName;
+    line.mHash = Hash::Get(csvLine);
+    Function::CC cc = Function::CC_UNKNOWN;
+    bool isEllipsis = false;
+    if (fnCC == "thiscall")
+        cc = Function::CC_THISCALL;
+    else if(fnCC == "cdecl" || fnCC == "voidarg")
+        cc = Function::CC_CDECL;
+    else if (fnCC == "ellipsis") {
+        cc = Function::CC_CDECL;
+        isEllipsis = true;
+    }
+    // if function name empty
+    if (fnDemName.empty()) {
+        line.mWarning = String::Format("function '%s' has no name", fnAddress.c_str());
+        return true;
+    }
+    // TODO: implement __usercall support?
+    if (cc == Function::CC_UNKNOWN) {
+        line.mWarning = String::Format("function '%s' (address %s) has non-supported calling convention type",
+            fnDemName.c_str(), fnAddress.c_str());
+        return true;
+    }
+    string fnScope, classScope;
+    auto bp = fnDemName.find('(');
+    if (bp != string::npos)
+        fnDemName = fnDemName.substr(0, bp);
+    String::Break(fnDemName, "::", fnScope, fnDemName, true);
+    Function &newFn = line.mFunction;
+    newFn.mVersionInfo[0].mAddress = String::ToNumber(fnAddress);
+    newFn.mName = fnDemName;
+    newFn.mMangledName = fnName;
+    newFn.mModuleName = fnModuleName;
+    newFn.mScope = fnScope;
+    if (!newFn.mScope.empty()) {
+        String::Break(newFn.mScope, "::", classScope, newFn.mShortClassName, true);
+        newFn.mFullClassName = newFn.mScope;
+    }
+    newFn.mCC = cc;
+    newFn.mType = fnType;
+    newFn.mVersionInfo[0].mRefsStr = fnRefsStr;
+    newFn.mCC = cc;
+    newFn.mIsEllipsis = isEllipsis;
+    newFn.mIsConst = String::ToNumber(fnIsConst);
+    newFn.mForceOverloadedMetaMacro = String::ToNumber(fnForceOverloaded);
+    newFn.mComment = fnComment;
+    newFn.mPriority = String::ToNumber(fnPriority);
+    newFn.mVTableIndex = String::ToNumber(fnVTableIndex);
+    string retType = fnRetType;
+    if (String::StartsWith(retType, "raw ")) {
+        retType = retType.substr(4);
+        newFn.mRetType.mWasSetFromRawType = true;
+    }
+    newFn.mRetType.SetFromString(retType);
+    if (!classScope.empty() && newFn.mRetType.mName == newFn.mShortClassName)
+        newFn.mRetType.mName = newFn.mFullClassName;
+    // raw CPool<CPed> *:pool int:value
+    // [raw] Type : Name
+    size_t currPos = 0;
+    while (1) {
+        auto colonPos = fnParameters.find(':', currPos);
+        if (colonPos == string::npos)
+            break;
+        string paramType = fnParameters.substr(currPos, colonPos - currPos);
+        String::Trim(paramType);
+        FunctionParameter param;
+        if (String::StartsWith(paramType, "raw ")) {
+            param.mType.SetFromString(paramType.substr(4));
+            param.mType.mWasSetFromRawType = true;
+        }
+        else
+            param.mType.SetFromString(paramType);
+        auto spacePos = fnParameters.find(' ', colonPos + 1);
+        if (spacePos == string::npos)
+            param.mName = fnParameters.substr(colonPos + 1);
+        else {
+            param.mName = fnParameters.substr(colonPos + 1, spacePos - (colonPos + 1));
+            currPos = spacePos + 1;
+        }
+        auto defPos = param.mName.find('(');
+        if (defPos != string::npos && param.mName.back() == ')') {
+            param.mDefValue = param.mName.substr(defPos + 1, param.mName.length() - defPos - 2);
+            param.mName = param.mName.substr(0, defPos);
+        }
+        newFn.mParameters.push_back(param);
+        if (spacePos == string::npos)
+            break;
+    }
+    bool isThiscall = newFn.mCC == Function::CC_THISCALL;
+    unsigned int rvoParamIndex = isThiscall ? 1 : 0;
+    IterateIndex(newFn.mParameters, [&](FunctionParameter &p, unsigned int index) {
+        if (index == 0 && isThiscall)
+            p.mName = "this";
+        else {
+            if (p.mName.empty())
+                p.mName = String::Format("arg%d", index + 1);
+            else {
+                if (index == rvoParamIndex && String::StartsWith(p.mName, "ret_")) {
+                    newFn.mRVOParamIndex = index;
+                }
+                else if (String::StartsWith(p.mName, "ref_")) {
+                    if (p.mType.mPointers.size() > 0 && p.mType.mPointers.back() == '*') {
+                        p.mType.mPointers.back() = '&';
+                        p.mName = p.mName.substr(4);
                     }
-                    Enum e;
-                    e.mName = JsonIO::readJsonString(j, "name");
-                    e.mModuleName = moduleName;
-                    e.mScope = JsonIO::readJsonString(j, "scope");
-                    e.mWidth = JsonIO::readJsonNumber(j, "width");
-                    e.mIsClass = JsonIO::readJsonBool(j, "isClass");
-                    e.mIsHexademical = JsonIO::readJsonBool(j, "isHexademical");
-                    e.mIsSigned = JsonIO::readJsonBool(j, "isSigned");
-                    e.mIsBitfield = JsonIO::readJsonBool(j, "isBitfield");
-                    e.mIsAnonymous = JsonIO::readJsonBool(j, "isAnonymous");
-                    e.mStartWord = JsonIO::readJsonString(j, "startWord");
-                    e.mComment = JsonIO::readJsonString(j, "comment");
-                    auto &members = j.find("members");
-                    if (members != j.end()) {
-                        for (auto const &jm : *members) {
-                            EnumMember m;
-                            m.mName = JsonIO::readJsonString(jm, "name");
-                            m.mValue = JsonIO::readJsonNumber(jm, "value");
-                            m.mComment = JsonIO::readJsonString(jm, "comment");
-                            m.mBitWidth = JsonIO::readJsonNumber(jm, "bitWidth");
-                            e.mMembers.push_back(m);
-                        }
+                }
+                else if (String::StartsWith(p.mName, "ws") && p.mType.mName == "wchar_t") {
+                    string wsType = p.mName.substr(2);
+                    if (String::StartsWith(wsType, "in_")) {
+                        p.mWSType = FunctionParameter::WSType::In;
+                        p.mName = wsType.substr(3);
+                        newFn.mHasWSParameters = true;
+                    }
+                    else if (String::StartsWith(wsType, "out_")) {
+                        p.mWSType = FunctionParameter::WSType::Out;
+                        p.mName = wsType.substr(4);
+                        newFn.mHasWSParameters = true;
+                    }
+                    else if (String::StartsWith(wsType, "inout_")) {
+                        p.mWSType = FunctionParameter::WSType::InOut;
+                        p.mName = wsType.substr(6);
+                        newFn.mHasWSParameters = true;
                     }
-                    m->mEnums.push_back(e);
                 }
             }
         }
+        if (!classScope.empty() && p.mType.mName == newFn.mShortClassName)
+            p.mType.mName = newFn.mFullClassName;
+    });
+    if (newFn.mRVOParamIndex != -1)
+        newFn.mNumParamsToSkipForWrapper = newFn.mRVOParamIndex + 1;
+    else if (isThiscall)
+        newFn.mNumParamsToSkipForWrapper = 1;
+
+    bool isInsideClass = !newFn.mFullClassName.empty();
+    newFn.mIsStatic = !isThiscall && isInsideClass;
+    newFn.mIsVirtual = newFn.mVTableIndex != -1;
+
+    // find function 'usage'
+    if (isInsideClass && newFn.mName == newFn.mShortClassName) {
+        if (newFn.mParameters.size() == 1)
+            newFn.mUsage = Function::Usage::DefaultConstructor;
+        else if (newFn.mParameters.size() >= 1 && newFn.mParameters[1].mType.mName == newFn.mShortClassName
+            && newFn.mParameters[1].mType.mPointers.size() == 1
+            && newFn.mParameters[1].mType.mPointers[0] == '&')
+        {
+            newFn.mUsage = Function::Usage::CopyConstructor;
+        }
+        else
+            newFn.mUsage = Function::Usage::CustomConstructor;
+    }
+    else if (isInsideClass && newFn.mName == "_" + newFn.mShortClassName || newFn.mName == "destructor"
+        || String::EndsWith(newFn.mMangledName, "D2Ev"))
+    {
+        newFn.mUsage = Function::Usage::BaseDestructor;
+    }
+    else if (isInsideClass && newFn.mName == "deleting_destructor" || String::EndsWith(newFn.mMangledName, "D0Ev"))
+        newFn.mUsage = Function::Usage::DeletingDestructor;
+    else if (String::StartsWith(newFn.mName, "operator")) {
+        if (String::StartsWith(newFn.mName.substr(9), "new")) {
+            bool isDefault = newFn.HasDefaultOpNewParams();
+            if (String::StartsWith(newFn.mName.substr(12), "[]"))
+                newFn.mUsage = isDefault ? Function::Usage::DefaultOperatorNewArray : Function::Usage::CustomOperatorNewArray;
+            else
+                newFn.mUsage = isDefault ? Function::Usage::DefaultOperatorNew : Function::Usage::CustomOperatorNew;
+        }
+        else if (String::StartsWith(newFn.mName.substr(9), "delete")) {
+            bool isDefault = newFn.HasDefaultOpDeleteParams();
+            if (String::StartsWith(newFn.mName.substr(12), "[]"))
+                newFn.mUsage = isDefault ? Function::Usage::DefaultOperatorDeleteArray : Function::Usage::CustomOperatorDeleteArray;
+            else
+                newFn.mUsage = isDefault ? Function::Usage::DefaultOperatorDelete : Function::Usage::CustomOperatorDelete;
+        }
+        else
+            newFn.mUsage = Function::Usage::Operator;
     }
 
-    // read structs
-    for (const auto& p : recursive_directory_iterator(gameDbPath / "structs")) {
-        if (p.path().extension() == ".json") {
-            cout << "    Reading struct " << p.path() << endl;
-            ifstream structFile(p.path().string());
-            if (structFile.is_open()) {
-                json j = json::parse(structFile);
-                string moduleName = JsonIO::readJsonString(j, "module");
-                if (!moduleName.empty()) {
-                    Module *m = Module::Find(modules, moduleName);
-                    if (!m) {
-                        Module tmp;
-                        tmp.mName = moduleName;
-                        modules.push_back(tmp);
-                        m = &modules.back();
-                    }
-                    string sName = JsonIO::readJsonString(j, "name");
-                    string sScope = JsonIO::readJsonString(j, "scope");
-                    if (sName.rfind("::") != string::npos)
-                        String::Break(sName, "::", sScope, sName, true);
-                    Struct &s = *m->AddEmptyStruct(sName, sScope);
-                    s.mModuleName = moduleName;
-                    string kind = JsonIO::readJsonString(j, "kind");
-                    if (kind == "struct")
-                        s.mKind = Struct::Kind::Struct;
-                    else if (kind == "union")
-                        s.mKind = Struct::Kind::Union;
-                    else
-                        s.mKind = Struct::Kind::Class;
-                    s.mSize = JsonIO::readJsonNumber(j, "size");
-                    s.mAlignment = JsonIO::readJsonNumber(j, "alignment");
-                    if (!s.mIsAnonymous)
-                        s.mIsAnonymous = JsonIO::readJsonBool(j, "isAnonymous");
-                    s.mIsCoreClass = JsonIO::readJsonBool(j, "isCoreClass");
-                    s.mIsAbstractClass = JsonIO::readJsonBool(j, "isAbstract");
-                    s.mHasVectorDeletingDestructor = JsonIO::readJsonBool(j, "hasVectorDeletingDtor");
-                    s.mVTableAddress = JsonIO::readJsonNumber(j, "vtableAddress");
-                    s.mHasVTable = s.mVTableAddress != 0;
-                    s.mVTableSize = JsonIO::readJsonNumber(j, "vtableSize");
-                    s.mComment = JsonIO::readJsonString(j, "comment");
-                    auto &members = j.find("members");
-                    if (members != j.end()) {
-                        for (auto const &jm : *members) {
-                            StructMember m;
-                            m.mName = JsonIO::readJsonString(jm, "name");
-                            string fullType = JsonIO::readJsonString(jm, "rawType"); // read custom type
-                            if (fullType.empty()) // if custom is not defined, read default type
-                                fullType = JsonIO::readJsonString(jm, "type");
-                            else
-                                m.mType.mWasSetFromRawType = true;
-                            m.mOffset = JsonIO::readJsonNumber(jm, "offset");
-                            m.mSize = JsonIO::readJsonNumber(jm, "size");
-                            bool isAnonymous = JsonIO::readJsonBool(jm, "isAnonymous");
-                            bool isBaseClass = JsonIO::readJsonBool(jm, "isBase");
-                            bool isBitfield = JsonIO::readJsonBool(jm, "isBitfield");
-                            m.mComment = JsonIO::readJsonString(jm, "comment");
-                            if (fullType.empty()) {
-                                if (m.mSize == 1)
-                                    fullType = "char";
-                                else if (m.mSize == 2)
-                                    fullType = "short";
-                                else if (m.mSize == 4)
-                                    fullType = "int";
-                                else
-                                    fullType = "char[" + to_string(m.mSize) + "]";
-                            }
-                            m.mType.SetFromString(fullType);
-                            if (s.mParentName.empty() &&
-                                (isBaseClass || m.mName == "base" || String::StartsWith(m.mName, "baseclass_")))
-                            {
-                                m.mIsBase = true;
-                                s.mParentName = m.mType.mName;
-                            }
-                            if (isAnonymous || String::StartsWith(m.mName, "anonymous_"))
-                                m.mIsAnonymous = true;
-                            if (String::StartsWith(m.mName, "_pad") || String::StartsWith(m.mName, "__pad")) {
-                                m.mName = "_pad" + String::ToHexString(m.mOffset, false);
-                                m.mIsPadding = true;
-                            }
-                            if (!s.mHasVTableMember && m.mOffset == 0 && (m.mName == "vtable" || m.mName == "vftable" || m.mName == "vmt")) {
-                                m.mIsVTable = true;
-                                s.mHasVTableMember = true;
-                            }
-                            if (isBitfield) {
-                                m.mBitfield = s.mModule->FindEnum(m.mType.mName);
-                                if (m.mBitfield)
-                                    m.mBitfield->mUsedAsBitfieldMember = true;
-                            }
-                            s.mMembers.push_back(m);
-                        }
-                    }
+    // change ret type from pointer to ref (for operators)
+    if (isInsideClass && newFn.mUsage == Function::Usage::Operator) {
+        if ((newFn.mRetType.mName == newFn.mShortClassName || newFn.mRetType.mName == newFn.mFullClassName)
+            && newFn.mRetType.mPointers.size() == 1 && newFn.mRetType.mPointers[0] == '*')
+        {
+            newFn.mRetType.mPointers[0] = '&';
+        }
+    }
+
+    // fix destructor name
+    if (newFn.IsDestructor())
+        newFn.mName = "~" + newFn.mShortClassName;
+    line.mClassScope = classScope;
+    return true;
+}
+
+bool Generator::ReadVariableReferenceLine(string_view csvLine, JsonFileCache::ReferenceLine &line) {
+    string varBaseAddress, varRefName;
+    CSV::Read(csvLine, varBaseAddress, line.mRefAddressStr, varRefName);
+    return ReadReferenceAddresses(varBaseAddress, line);
+}
+
+bool Generator::ReadFunctionReferenceLine(string_view csvLine, JsonFileCache::ReferenceLine &line) {
+    string fnBaseAddress, fnRefName;
+    CSV::Read(csvLine, fnBaseAddress, line.mRefAddressStr, line.mRefsList, fnRefName);
+    return ReadReferenceAddresses(fnBaseAddress, line);
+}
+
+bool Generator::ReadReferenceAddresses(string const &baseAddress, JsonFileCache::ReferenceLine &line) {
+    // lines without reference address or with zero addresses are skipped
+    if (line.mRefAddressStr.empty())
+        return false;
+    line.mRefAddress = String::ToNumber(line.mRefAddressStr);
+    if (line.mRefAddress == 0)
+        return false;
+    line.mBaseAddress = String::ToNumber(baseAddress);
+    return line.mBaseAddress != 0;
+}
+
+// read and decode csv file lines; with cache, lines of files which were not changed since previous run are not decoded again.
+// Returns nullptr if the file can't be opened
+template<typename T>
+Vector<T> const *ReadCsvFile(path const &filepath, Vector<T> &lines, JsonFileCache::Map<Vector<T>> *cache, unsigned int &numParsed,
+    bool (*readLine)(string_view, T &)) {
+    unsigned long long stamp = 0;
+    if (cache) {
+        stamp = JsonFileCache::GetFileStamp(filepath);
+        auto it = cache->find(filepath.string());
+        if (it != cache->end() && it->second.mStamp == stamp)
+            return &it->second.mDecoded;
+    }
+    MappedFile file(filepath);
+    if (!file.IsOpen()) {
+        if (cache)
+            cache->erase(filepath.string());
+        return nullptr;
+    }
+    for (string_view csvLine : CSV::ReadLines(file)) {
+        T line;
+        if (readLine(csvLine, line))
+            lines.push_back(move(line));
+    }
+    numParsed++;
+    if (!cache)
+        return &lines;
+    Arena::Scope heapScope(nullptr);
+    auto &entry = (*cache)[filepath.string()];
+    entry.mStamp = stamp;
+    entry.mDecoded = move(lines);
+    return &entry.mDecoded;
+}
+
+void Generator::ReadGame(List<Module> &modules, SymbolTable &symbols, path const &sdkpath, Games::IDs game, Options const &options,
+    JsonFileCache *cache) {
+
+    path gameDbPath = Paths::GetDatabaseDir(sdkpath, game);
+
+    // read enums and structs: json files are parsed in worker threads, then decoded
+    // enums/structs are added to modules in directory order (enums must be added
+    // before structs - bitfield members are linked with enums when struct is added)
+    Trace::Scope enumsTraceScope("json", "Read enums");
+    auto enumFiles = GetJsonFiles(gameDbPath / "enums");
+    Vector<Enum> enums(enumFiles.size());
+    Vector<unsigned long long> enumHashes(enumFiles.size());
+    unsigned int numParsed = 0, numCsvFiles = 0; // files parsed in this run (not taken from cache), csv files read
+    ReadJsonFiles(enumFiles, enums, enumHashes, cache ? &cache->mEnums : nullptr, numParsed, options, ReadEnumFile);
+    for (size_t i = 0; i < enumFiles.size(); i++) {
+        Log::Out() << "    Reading enum " << enumFiles[i] << endl;
+        if (!enums[i].mModuleName.empty()) {
+            Module *m = FindOrAddModule(modules, symbols, enums[i].mModuleName, game);
+            m->AddInputHash(enumHashes[i]);
+            m->AddEnum(move(enums[i]));
+        }
+    }
+    enums.clear();
+    enumsTraceScope.Stop();
+
+    Trace::Scope structsTraceScope("json", "Read structs");
+    auto structFiles = GetJsonFiles(gameDbPath / "structs");
+    Vector<Struct> structs(structFiles.size());
+    Vector<unsigned long long> structHashes(structFiles.size());
+    ReadJsonFiles(structFiles, structs, structHashes, cache ? &cache->mStructs : nullptr, numParsed, options, ReadStructFile);
+    for (size_t i = 0; i < structFiles.size(); i++) {
+        Log::Out() << "    Reading struct " << structFiles[i] << endl;
+        Struct &decoded = structs[i];
+        if (!decoded.mModuleName.empty()) {
+            Module *m = FindOrAddModule(modules, symbols, decoded.mModuleName, game);
+            m->AddInputHash(structHashes[i]);
+            Struct &s = *m->AddEmptyStruct(decoded.mName, decoded.mScope);
+            s.mModuleName = decoded.mModuleName;
+            s.mKind = decoded.mKind;
+            s.mSize = decoded.mSize;
+            s.mAlignment = decoded.mAlignment;
+            if (!s.mIsAnonymous)
+                s.mIsAnonymous = decoded.mIsAnonymous;
+            s.mIsCoreClass = decoded.mIsCoreClass;
+            s.mIsAbstractClass = decoded.mIsAbstractClass;
+            s.mHasVectorDeletingDestructor = decoded.mHasVectorDeletingDestructor;
+            s.mVTableAddress = decoded.mVTableAddress;
+            s.mHasVTable = decoded.mHasVTable;
+            s.mVTableSize = decoded.mVTableSize;
+            s.mComment = move(decoded.mComment);
+            s.mParentName = move(decoded.mParentName);
+            s.mHasVTableMember = decoded.mHasVTableMember;
+            s.mMembers = move(decoded.mMembers);
+            for (auto &member : s.mMembers) {
+                if (member.mIsBitfield) {
+                    member.mBitfield = s.mModule->FindEnum(member.mType.mName);
+                    if (member.mBitfield)
+                        member.mBitfield->mUsedAsBitfieldMember = true;
                 }
             }
         }
     }
+    structs.clear();
+    structsTraceScope.Stop();
 
     if (Games::GetGameVersionsCount(game) > 0) {
+        // base address -> entity, for reference versions
+        unordered_map<unsigned int, Variable *> varsIndex;
+        unordered_map<unsigned int, Function *> funcsIndex;
+
         // read variables file for each game version:
         // 1.0 us/english version should be always present, and its index is always '0'.
         for (unsigned int i = 0; i < Games::GetGameVersionsCount(game); i++) {
-            cout << "    Reading variables for GTA " << Games::GetGameAbbr(game) << " " << Games::GetGameVersionName(game, i) << endl;
+            Log::Out() << "    Reading variables for GTA " << Games::GetGameAbbr(game) << " " << Games::GetGameVersionName(game, i) << endl;
+            Trace::Scope traceScope("csv", "Read variables", Games::GetGameVersionName(game, i));
             // example filepath: plugin-sdk.sa.variables.10us.csv
             path varsFilePath = gameDbPath / ("plugin-sdk." + Games::GetGameAbbrLow(game) + ".variables." + Games::GetGameVersionName(game, i) + ".csv");
-            std::ifstream varsFile(varsFilePath);
-            if (!varsFile.is_open()) {
+            numCsvFiles++;
+            // if base version
+            if (i == 0) {
+                Vector<JsonFileCache::VariableLine> decoded;
+                auto lines = ReadCsvFile(varsFilePath, decoded, cache ? &cache->mVariables : nullptr, numParsed, ReadVariableLine);
                 // exit if can't open base file
-                if (i == 0) {
-                    cout << "ERROR (%s): Unable to open base file for variables (%s)", __FUNCTION__, varsFilePath.string().c_str();
+                if (!lines) {
+                    Log::Out() << "ERROR (%s): Unable to open base file for variables (%s)", __FUNCTION__, varsFilePath.string().c_str();
                     break;
                 }
-            }
-            else {
-                auto csvLines = CSV::ReadLines(varsFile);
-                // if base version
-                if (i == 0) {
-                    for (string const &csvLine : csvLines) {
-                        string varAddress, varModuleName, varName, varDemName, varType, varRawType, varSize, varDefaultValues, varComment, varIsReadOnly;
-                        CSV::Read(csvLine, varAddress, varModuleName, varName, varDemName, varType, varRawType, varSize, varDefaultValues, varComment, varIsReadOnly);
-                        if (!varModuleName.empty()) {
-                            // get module for this variable
-                            Module *m = Module::Find(modules, varModuleName);
-                            if (!m) {
-                                Module tmp;
-                                tmp.mName = varModuleName;
-                                modules.push_back(tmp);
-                                m = &modules.back();
-                            }
-                            // get variable type
-                            string finalVarType = varRawType;
-                            if (finalVarType.empty())
-                                finalVarType = varType;
-                            // if var type and var name are not empty
-                            if (!finalVarType.empty() && !varDemName.empty()) {
-                                string varScope;
-                                String::Break(varDemName, "::", varScope, varDemName, true);
-                                Variable newVar;
-                                newVar.mName = varDemName;
-                                newVar.mMangledName = varName;
-                                newVar.mModuleName = varModuleName;
-                                newVar.mScope = varScope;
-                                newVar.mDefaultValues = varDefaultValues;
-                                newVar.mComment = varComment;
-                                newVar.mType.SetFromString(finalVarType);
-                                newVar.mSize = String::ToNumber(varSize);
-                                newVar.mVersionInfo[0].mAddress = String::ToNumber(varAddress);
-                                newVar.mIsReadOnly = String::ToNumber(varIsReadOnly);
-                                if (varScope.empty())
-                                    m->mVariables.push_back(newVar);
-                                else {
-                                    // find class inside module
-                                    Struct *s = m->FindStruct(varScope, true);
-                                    if (s)
-                                        s->mVariables.push_back(newVar);
-                                    else {
-                                        // variable class not found
-                                        string newClassName, newClassScope;
-                                        String::Break(varScope, "::", newClassScope, newClassName, true);
-                                        Struct *newClass = m->AddEmptyStruct(newClassName, newClassScope);
-                                        newClass->mKind = Struct::Kind::Class;
-                                        newClass->mVariables.push_back(newVar);
-                                    }
-                                }
-                            }
-                            else {
-                                m->mWarnings.push_back(String::Format("wrong variable '(%s) %s' (address %s)",
-                                    (finalVarType.empty()? "<no-type>" : finalVarType.c_str()),
-                                    (varDemName.empty() ? "<no-name>" : varDemName.c_str()), varAddress.c_str()));
-                            }
+                for (auto const &line : *lines) {
+                    // get module for this variable
+                    Module *m = FindOrAddModule(modules, symbols, line.mModuleName, game);
+                    m->AddInputHash(line.mHash);
+                    if (!line.mWarning.empty()) {
+                        m->mWarnings.push_back(line.mWarning);
+                        continue;
+                    }
+                    Variable const &newVar = line.mVariable;
+                    if (newVar.mScope.empty())
+                        m->mVariables.push_back(newVar);
+                    else {
+                        // find class inside module
+                        Struct *s = m->FindStruct(newVar.mScope, true);
+                        if (s)
+                            s->mVariables.push_back(newVar);
+                        else {
+                            // variable class not found
+                            string newClassName, newClassScope;
+                            String::Break(newVar.mScope, "::", newClassScope, newClassName, true);
+                            Struct *newClass = m->AddEmptyStruct(newClassName, newClassScope);
+                            newClass->mKind = Struct::Kind::Class;
+                            newClass->mVariables.push_back(newVar);
                         }
                     }
                 }
-                else {
-                    for (string const &csvLine : csvLines) {
-                        string varBaseAddress, varRefAddress, varRefName;
-                        CSV::Read(csvLine, varBaseAddress, varRefAddress, varRefName);
-                        if (!varRefAddress.empty()) {
-                            unsigned int refAddress = String::ToNumber(varRefAddress);
-                            if (refAddress != 0) {
-                                unsigned int baseAddress = String::ToNumber(varBaseAddress);
-                                if (baseAddress != 0) {
-                                    for (auto &m : modules) {
-                                        Variable *pv = m.GetVariable(baseAddress);
-                                        if (pv) {
-                                            pv->mVersionInfo[i].mAddress = refAddress;
-                                            break;
-                                        }
-                                    }
-                                }
-                            }
-                        }
+            }
+            else {
+                Vector<JsonFileCache::ReferenceLine> decoded;
+                auto lines = ReadCsvFile(varsFilePath, decoded, cache ? &cache->mVariableReferences : nullptr, numParsed,
+                    ReadVariableReferenceLine);
+                if (!lines)
+                    continue;
+                // index is built once, after base version is loaded
+                if (varsIndex.empty())
+                    varsIndex = BuildVariablesIndex(modules);
+                Vector<unsigned int> missingAddresses;
+                for (auto const &line : *lines) {
+                    auto it = varsIndex.find(line.mBaseAddress);
+                    if (it != varsIndex.end()) {
+                        it->second->mVersionInfo[i].mAddress = line.mRefAddress;
+                        AddInputHash(symbols, it->second->mModuleName, to_string(i) + ' ' + line.mRefAddressStr);
                     }
+                    else
+                        missingAddresses.push_back(line.mBaseAddress);
                 }
-                varsFile.close();
+                ReportMissingAddresses("variable", missingAddresses);
             }
         }
 
         // read functions file for each game version:
         // 1.0 us/english version should be always present, and its index is always '0'.
         for (unsigned int i = 0; i < Games::GetGameVersionsCount(game); i++) {
-            cout << "    Reading functions for GTA " << Games::GetGameAbbr(game) << " " << Games::GetGameVersionName(game, i) << endl;
+            Log::Out() << "    Reading functions for GTA " << Games::GetGameAbbr(game) << " " << Games::GetGameVersionName(game, i) << endl;
+            Trace::Scope traceScope("csv", "Read functions", Games::GetGameVersionName(game, i));
             // example filepath: plugin-sdk.sa.functions.10us.csv
             path funcsFilePath = gameDbPath / ("plugin-sdk." + Games::GetGameAbbrLow(game) + ".functions." + Games::GetGameVersionName(game, i) + ".csv");
-            std::ifstream funcsFile(funcsFilePath);
-            if (!funcsFile.is_open()) {
+            numCsvFiles++;
+            // if base version
+            if (i == 0) {
+                Vector<JsonFileCache::FunctionLine> decoded;
+                auto lines = ReadCsvFile(funcsFilePath, decoded, cache ? &cache->mFunctions : nullptr, numParsed, ReadFunctionLine);
                 // exit if can't open base file
-                if (i == 0) {
-                    cout << "ERROR (%s): Unable to open base file for functions (%s)", __FUNCTION__, funcsFilePath.string().c_str();
+                if (!lines) {
+                    Log::Out() << "ERROR (%s): Unable to open base file for functions (%s)", __FUNCTION__, funcsFilePath.string().c_str();
                     break;
                 }
-            }
-            else {
-                auto csvLines = CSV::ReadLines(funcsFile);
-                // if base version
-                if (i == 0) {
-                    for (string const &csvLine : csvLines) {
-                        // 10us,Module,Name,DemangledName,Type,CC,RetType,Parameters,IsConst,Comment
-                        string fnAddress, fnModuleName, fnName, fnDemName, fnType, fnCC, fnRetType, fnParameters, fnIsConst, 
-                            fnRefsStr, fnComment, fnPriority, fnVTableIndex, fnForceOverloaded;
-                        CSV::Read(csvLine, fnAddress, fnModuleName, fnName, fnDemName, fnType, fnCC, fnRetType, fnParameters,
-                            fnIsConst, fnRefsStr, fnComment, fnPriority, fnVTableIndex, fnForceOverloaded);
-                        if (!fnModuleName.empty()) {
-                            // get module for this function
-                            Module *m = Module::Find(modules, fnModuleName);
-                            if (!m) {
-                                Module tmp;
-                                tmp.mName = fnModuleName;
-                                modules.push_back(tmp);
-                                m = &modules.back();
-                            }
-                            Function::CC cc = Function::CC_UNKNOWN;
-                            bool isEllipsis = false;
-                            if (fnCC == "thiscall")
-                                cc = Function::CC_THISCALL;
-                            else if(fnCC == "cdecl" || fnCC == "voidarg")
-                                cc = Function::CC_CDECL;
-                            else if (fnCC == "ellipsis") {
-                                cc = Function::CC_CDECL;
-                                isEllipsis = true;
-                            }
-                            // if function name empty
-                            if (fnDemName.empty()) {
-                                m->mWarnings.push_back(String::Format("function '%s' has no name", fnAddress.c_str()));
-                            }
-                            // TODO: implement __usercall support?
-                            else if (cc == Function::CC_UNKNOWN) {
-                                m->mWarnings.push_back(String::Format("function '%s' (address %s) has non-supported calling convention type",
-                                    fnDemName.c_str(), fnAddress.c_str()));
-                            }
-                            else {
-                                string fnScope, classScope;
-                                auto bp = fnDemName.find('(');
-                                if (bp != string::npos)
-                                    fnDemName = fnDemName.substr(0, bp);
-                                String::Break(fnDemName, "::", fnScope, fnDemName, true);
-                                Function newFn;
-                                newFn.mVersionInfo[0].mAddress = String::ToNumber(fnAddress);
-                                newFn.mName = fnDemName;
-                                newFn.mMangledName = fnName;
-                                newFn.mModuleName = fnModuleName;
-                                newFn.mScope = fnScope;
-                                if (!newFn.mScope.empty()) {
-                                    String::Break(newFn.mScope, "::", classScope, newFn.mShortClassName, true);
-                                    newFn.mFullClassName = newFn.mScope;
-                                }
-                                newFn.mCC = cc;
-                                newFn.mType = fnType;
-                                newFn.mVersionInfo[0].mRefsStr = fnRefsStr;
-                                newFn.mCC = cc;
-                                newFn.mIsEllipsis = isEllipsis;
-                                newFn.mIsConst = String::ToNumber(fnIsConst);
-                                newFn.mForceOverloadedMetaMacro = String::ToNumber(fnForceOverloaded);
-                                newFn.mComment = fnComment;
-                                newFn.mPriority = String::ToNumber(fnPriority);
-                                newFn.mVTableIndex = String::ToNumber(fnVTableIndex);
-                                string retType = fnRetType;
-                                if (String::StartsWith(retType, "raw ")) {
-                                    retType = retType.substr(4);
-                                    newFn.mRetType.mWasSetFromRawType = true;
-                                }
-                                newFn.mRetType.SetFromString(retType);
-                                if (!classScope.empty() && newFn.mRetType.mName == newFn.mShortClassName)
-                                    newFn.mRetType.mName = newFn.mFullClassName;
-                                // raw CPool<CPed> *:pool int:value
-                                // [raw] Type : Name
-                                size_t currPos = 0;
-                                while (1) {
-                                    auto colonPos = fnParameters.find(':', currPos);
-                                    if (colonPos == string::npos)
-                                        break;
-                                    string paramType = fnParameters.substr(currPos, colonPos - currPos);
-                                    String::Trim(paramType);
-                                    FunctionParameter param;
-                                    if (String::StartsWith(paramType, "raw ")) {
-                                        param.mType.SetFromString(paramType.substr(4));
-                                        param.mType.mWasSetFromRawType = true;
-                                    }
-                                    else
-                                        param.mType.SetFromString(paramType);
-                                    auto spacePos = fnParameters.find(' ', colonPos + 1);
-                                    if (spacePos == string::npos)
-                                        param.mName = fnParameters.substr(colonPos + 1);
-                                    else {
-                                        param.mName = fnParameters.substr(colonPos + 1, spacePos - (colonPos + 1));
-                                        currPos = spacePos + 1;
-                                    }
-                                    auto defPos = param.mName.find('(');
-                                    if (defPos != string::npos && param.mName.back() == ')') {
-                                        param.mDefValue = param.mName.substr(defPos + 1, param.mName.length() - defPos - 2);
-                                        param.mName = param.mName.substr(0, defPos);
-                                    }
-                                    newFn.mParameters.push_back(param);
-                                    if (spacePos == string::npos)
-                                        break;
-                                }
-                                bool isThiscall = newFn.mCC == Function::CC_THISCALL;
-                                unsigned int rvoParamIndex = isThiscall ? 1 : 0;
-                                IterateIndex(newFn.mParameters, [&](FunctionParameter &p, unsigned int index) {
-                                    if (index == 0 && isThiscall)
-                                        p.mName = "this";
-                                    else {
-                                        if (p.mName.empty())
-                                            p.mName = String::Format("arg%d", index + 1);
-                                        else {
-                                            if (index == rvoParamIndex && String::StartsWith(p.mName, "ret_")) {
-                                                newFn.mRVOParamIndex = index;
-                                            }
-                                            else if (String::StartsWith(p.mName, "ref_")) {
-                                                if (p.mType.mPointers.size() > 0 && p.mType.mPointers.back() == '*') {
-                                                    p.mType.mPointers.back() = '&';
-                                                    p.mName = p.mName.substr(4);
-                                                }
-                                            }
-                                            else if (String::StartsWith(p.mName, "ws") && p.mType.mName == "wchar_t") {
-                                                string wsType = p.mName.substr(2);
-                                                if (String::StartsWith(wsType, "in_")) {
-                                                    p.mWSType = FunctionParameter::WSType::In;
-                                                    p.mName = wsType.substr(3);
-                                                    newFn.mHasWSParameters = true;
-                                                }
-                                                else if (String::StartsWith(wsType, "out_")) {
-                                                    p.mWSType = FunctionParameter::WSType::Out;
-                                                    p.mName = wsType.substr(4);
-                                                    newFn.mHasWSParameters = true;
-                                                }
-                                                else if (String::StartsWith(wsType, "inout_")) {
-                                                    p.mWSType = FunctionParameter::WSType::InOut;
-                                                    p.mName = wsType.substr(6);
-                                                    newFn.mHasWSParameters = true;
-                                                }
-                                            }
-                                        }
-                                    }
-                                    if (!classScope.empty() && p.mType.mName == newFn.mShortClassName)
-                                        p.mType.mName = newFn.mFullClassName;
-                                });
-                                if (newFn.mRVOParamIndex != -1)
-                                    newFn.mNumParamsToSkipForWrapper = newFn.mRVOParamIndex + 1;
-                                else if (isThiscall)
-                                    newFn.mNumParamsToSkipForWrapper = 1;
-
-                                bool isInsideClass = !newFn.mFullClassName.empty();
-                                newFn.mIsStatic = !isThiscall && isInsideClass;
-                                newFn.mIsVirtual = newFn.mVTableIndex != -1;
-
-                                // find function 'usage'
-                                if (isInsideClass && newFn.mName == newFn.mShortClassName) {
-                                    if (newFn.mParameters.size() == 1)
-                                        newFn.mUsage = Function::Usage::DefaultConstructor;
-                                    else if (newFn.mParameters.size() >= 1 && newFn.mParameters[1].mType.mName == newFn.mShortClassName
-                                        && newFn.mParameters[1].mType.mPointers.size() == 1
-                                        && newFn.mParameters[1].mType.mPointers[0] == '&')
-                                    {
-                                        newFn.mUsage = Function::Usage::CopyConstructor;
-                                    }
-                                    else
-                                        newFn.mUsage = Function::Usage::CustomConstructor;
-                                }
-                                else if (isInsideClass && newFn.mName == "_" + newFn.mShortClassName || newFn.mName == "destructor"
-                                    || String::EndsWith(newFn.mMangledName, "D2Ev"))
-                                {
-                                    newFn.mUsage = Function::Usage::BaseDestructor;
-                                }
-                                else if (isInsideClass && newFn.mName == "deleting_destructor" || String::EndsWith(newFn.mMangledName, "D0Ev"))
-                                    newFn.mUsage = Function::Usage::DeletingDestructor;
-                                else if (String::StartsWith(newFn.mName, "operator")) {
-                                    if (String::StartsWith(newFn.mName.substr(9), "new")) {
-                                        bool isDefault = newFn.HasDefaultOpNewParams();
-                                        if (String::StartsWith(newFn.mName.substr(12), "[]"))
-                                            newFn.mUsage = isDefault ? Function::Usage::DefaultOperatorNewArray : Function::Usage::CustomOperatorNewArray;
-                                        else
-                                            newFn.mUsage = isDefault ? Function::Usage::DefaultOperatorNew : Function::Usage::CustomOperatorNew;
-                                    }
-                                    else if (String::StartsWith(newFn.mName.substr(9), "delete")) {
-                                        bool isDefault = newFn.HasDefaultOpDeleteParams();
-                                        if (String::StartsWith(newFn.mName.substr(12), "[]"))
-                                            newFn.mUsage = isDefault ? Function::Usage::DefaultOperatorDeleteArray : Function::Usage::CustomOperatorDeleteArray;
-                                        else
-                                            newFn.mUsage = isDefault ? Function::Usage::DefaultOperatorDelete : Function::Usage::CustomOperatorDelete;
-                                    }
-                                    else
-                                        newFn.mUsage = Function::Usage::Operator;
-                                }
-
-                                // change ret type from pointer to ref (for operators)
-                                if (isInsideClass && newFn.mUsage == Function::Usage::Operator) {
-                                    if ((newFn.mRetType.mName == newFn.mShortClassName || newFn.mRetType.mName == newFn.mFullClassName)
-                                        && newFn.mRetType.mPointers.size() == 1 && newFn.mRetType.mPointers[0] == '*')
-                                    {
-                                        newFn.mRetType.mPointers[0] = '&';
-                                    }
-                                }
-
-                                // fix destructor name
-                                if (newFn.IsDestructor())
-                                    newFn.mName = "~" + newFn.mShortClassName;
-
-                                if (fnScope.empty())
-                                    m->AddFunction(newFn);
-                                else {
-                                    // find class inside module
-                                    Struct *s = m->FindStruct(fnScope, true);
-                                    if (s)
-                                        s->AddFunction(newFn);
-                                    else {
-                                        // function class not found
-                                        Struct *newClass = m->AddEmptyStruct(newFn.mShortClassName, classScope);
-                                        newClass->AddFunction(newFn);
-                                    }
-                                }
-                            }
+                for (auto const &line : *lines) {
+                    // get module for this function
+                    Module *m = FindOrAddModule(modules, symbols, line.mModuleName, game);
+                    m->AddInputHash(line.mHash);
+                    if (!line.mWarning.empty()) {
+                        m->mWarnings.push_back(line.mWarning);
+                        continue;
+                    }
+                    // AddFunction() changes the function, decoded line can be used again in next run
+                    Function newFn = line.mFunction;
+                    if (newFn.mScope.empty())
+                        m->AddFunction(newFn);
+                    else {
+                        // find class inside module
+                        Struct *s = m->FindStruct(newFn.mScope, true);
+                        if (s)
+                            s->AddFunction(newFn);
+                        else {
+                            // function class not found
+                            Struct *newClass = m->AddEmptyStruct(newFn.mShortClassName, line.mClassScope);
+                            newClass->AddFunction(newFn);
                         }
                     }
                 }
-                else {
-                    for (string const &csvLine : csvLines) {
-                        string fnBaseAddress, fnRefAddress, fnRefsList, fnRefName;
-                        CSV::Read(csvLine, fnBaseAddress, fnRefAddress, fnRefsList, fnRefName);
-                        if (!fnRefAddress.empty()) {
-                            unsigned int refAddress = String::ToNumber(fnRefAddress);
-                            if (refAddress != 0) {
-                                unsigned int baseAddress = String::ToNumber(fnBaseAddress);
-                                if (baseAddress != 0) {
-                                    for (auto &m : modules) {
-                                        Function *pf = m.GetFunction(baseAddress);
-                                        if (pf) {
-                                            pf->mVersionInfo[i].mAddress = refAddress;
-                                            pf->mVersionInfo[i].mRefsStr = fnRefsList;
-                                            break;
-                                        }
-                                    }
-                                }
-                            }
-                        }
+            }
+            else {
+                Vector<JsonFileCache::ReferenceLine> decoded;
+                auto lines = ReadCsvFile(funcsFilePath, decoded, cache ? &cache->mFunctionReferences : nullptr, numParsed,
+                    ReadFunctionReferenceLine);
+                if (!lines)
+                    continue;
+                // index is built once, after base version is loaded
+                if (funcsIndex.empty())
+                    funcsIndex = BuildFunctionsIndex(modules);
+                Vector<unsigned int> missingAddresses;
+                for (auto const &line : *lines) {
+                    auto it = funcsIndex.find(line.mBaseAddress);
+                    if (it != funcsIndex.end()) {
+                        it->second->mVersionInfo[i].mAddress = line.mRefAddress;
+                        it->second->mVersionInfo[i].mRefsStr = line.mRefsList;
+                        AddInputHash(symbols, it->second->mModuleName, to_string(i) + ' ' + line.mRefAddressStr + ' ' + line.mRefsList);
                     }
+                    else
+                        missingAddresses.push_back(line.mBaseAddress);
                 }
-                funcsFile.close();
+                ReportMissingAddresses("function", missingAddresses);
             }
         }
     }
+    if (cache) {
+        cache->mNumParsed = numParsed;
+        cache->mNumReused = enumFiles.size() + structFiles.size() + numCsvFiles - numParsed;
+    }
 }
 
-void Generator::WriteModules(path const &sdkpath, Games::IDs game, List<Module> &modules) {
+void Generator::WriteModules(path const &sdkpath, Games::IDs game, List<Module> &modules, Options const &options) {
     path folder = Paths::GetModulesDir(sdkpath, game);
+    path manifestPath = Paths::GetManifestPath(sdkpath, game);
+    // manifest is always updated, but previous one is used only in incremental mode
+    Manifest prevManifest, manifest;
+    if (options.mIncremental)
+        prevManifest.Read(manifestPath);
+    unsigned int numWritten = 0, numUpToDate = 0;
+    unsigned int numWrittenFiles = 0, numUnchangedFiles = 0;
+    unsigned long long numOutputBytes = 0, numOutputNewLines = 0;
+    Vector<Module *> modulesToWrite;
+    Vector<unsigned long long> hashes;
     for (auto &m : modules) {
-        cout << "GTA" << Games::GetGameAbbr(game) << ": Writing module '" << m.mName << "'" << endl;
-        m.Write(folder, modules, game);
+        unsigned long long hash = GetModuleHash(m);
+        if (options.mIncremental && prevManifest.IsUpToDate(m.mName, hash) && m.FilesExist(folder)) {
+            manifest.mModuleHashes[m.mName] = hash;
+            numUpToDate++;
+            continue;
+        }
+        modulesToWrite.push_back(&m);
+        hashes.push_back(hash);
+    }
+    // the model is not modified while writing, so modules are written in worker threads; each module
+    // has its own log, logs are printed in module order - the output doesn't depend on thread count
+    Vector<string> logs(modulesToWrite.size());
+    Vector<char> results(modulesToWrite.size());
+    ostream &gameLog = Log::Out();
+    string gameName = "GTA " + Games::GetGameAbbr(game);
+    Parallel::For(modulesToWrite.size(), options.mJobs, [&](size_t i) {
+        Module &m = *modulesToWrite[i];
+        Trace::Scope traceScope("module", m.mName, gameName);
+        ostringstream moduleLog;
+        Log::SetStream(&moduleLog);
+        Log::Out() << "GTA" << Games::GetGameAbbr(game) << ": Writing module '" << m.mName << "'" << endl;
+        results[i] = m.Write(folder, modules, game);
+        Log::SetStream(&gameLog);
+        logs[i] = moduleLog.str();
+    });
+    for (size_t i = 0; i < modulesToWrite.size(); i++) {
+        Module &m = *modulesToWrite[i];
+        Log::Out() << logs[i];
+        if (results[i])
+            manifest.mModuleHashes[m.mName] = hashes[i];
+        numWritten++;
+        numWrittenFiles += m.mNumWrittenFiles;
+        numUnchangedFiles += m.mNumUnchangedFiles;
+        numOutputBytes += m.mNumOutputBytes;
+        numOutputNewLines += m.mNumOutputNewLines;
+    }
+    if (!manifest.Write(manifestPath))
+        ErrorCode(0, "%s: Unable to write manifest file (%s)", __FUNCTION__, manifestPath.string().c_str());
+    if (options.mIncremental)
+        Log::Out() << "GTA" << Games::GetGameAbbr(game) << ": " << numWritten << " modules written, " << numUpToDate << " up to date" << endl;
+    Log::Out() << "GTA" << Games::GetGameAbbr(game) << ": " << numWrittenFiles << " files written, " << numUnchangedFiles << " unchanged" << endl;
+    if (options.mStats) {
+        // with ofstream and endl every line was flushed (one write call per line)
+        Log::Out() << "GTA" << Games::GetGameAbbr(game) << ": " << numOutputBytes << " bytes generated, "
+            << numWrittenFiles << " write calls (" << (numOutputNewLines + numUnchangedFiles)
+            << " saved: " << numOutputNewLines << " line flushes, " << numUnchangedFiles << " unchanged files)" << endl;
+    }
+}
+
+unsigned long long Generator::GetModuleHash(Module &m) {
+    // module output depends on its own database entries and on the structs from other
+    // modules it uses: base classes (vtable, construction) and member classes (construction)
+    Set<Struct *> visited;
+    Vector<Struct *> structsToVisit;
+    for (auto &s : m.mStructs)
+        structsToVisit.push_back(&s);
+    Set<Module *> dependencies;
+    while (!structsToVisit.empty()) {
+        Struct *s = structsToVisit.back();
+        structsToVisit.pop_back();
+        if (!visited.insert(s).second)
+            continue;
+        if (s->mModule != &m)
+            dependencies.insert(s->mModule);
+        if (s->mParent)
+            structsToVisit.push_back(s->mParent);
+        for (auto ms : s->mMemberClasses)
+            structsToVisit.push_back(ms);
+    }
+    // Struct::CreateVTable() copies the vtable from the base class and writes overrides from derived
+    // classes into empty entries of base classes, so a struct with a vtable also depends on all
+    // structs of its vtable hierarchy (base and derived classes connected through classes with vtables)
+    Vector<Struct *> hierarchyToVisit;
+    for (auto &s : m.mStructs) {
+        if (s.mVTableSize == 0)
+            continue;
+        Struct *root = &s;
+        while (root->mParent && root->mParent->mVTableSize > 0)
+            root = root->mParent;
+        hierarchyToVisit.push_back(root);
     }
+    Set<Struct *> visitedHierarchy;
+    while (!hierarchyToVisit.empty()) {
+        Struct *s = hierarchyToVisit.back();
+        hierarchyToVisit.pop_back();
+        if (!visitedHierarchy.insert(s).second)
+            continue;
+        if (s->mModule != &m)
+            dependencies.insert(s->mModule);
+        for (auto cs : s->mChilds) {
+            if (cs->mVTableSize > 0)
+                hierarchyToVisit.push_back(cs);
+        }
+    }
+    Vector<Module *> sortedDependencies(dependencies.begin(), dependencies.end());
+    sort(sortedDependencies.begin(), sortedDependencies.end(), [](Module *a, Module *b) {
+        return a->mName < b->mName;
+    });
+    unsigned long long hash = Hash::Combine(Hash::Get(m.mName), m.mInputHash);
+    for (auto dm : sortedDependencies)
+        hash = Hash::Combine(Hash::Get(dm->mName, hash), dm->mInputHash);
+    return hash;
 }
 
-void Generator::UpdateModules(List<Module> &modules) {
+void Generator::UpdateModules(List<Module> &modules, SymbolTable &symbols, TypeGraph &graph) {
     if (modules.size() == 0)
         return;
-    for (Module &m : modules) {
-        for (Struct &s : m.mStructs) {
-            if (!s.mParentName.empty()) {
-                Struct *parent = nullptr;
-                for (Module &sm : modules) {
-                    parent = sm.FindStruct(s.mParentName, true);
-                    if (parent)
-                        break;
-                }
-                if (parent)
-                    s.SetParent(parent);
-            }
-        }
+    Trace::Scope traceScope("update", "UpdateModules");
+    graph.Build(modules, symbols);
+    for (auto const &node : graph.mNodes) {
+        if (node.mParent != -1)
+            node.mStruct->SetParent(graph.mNodes[node.mParent].mStruct);
     }
     for (Module &m : modules) {
+        Trace::Scope moduleTraceScope("update", "OnUpdateStructs", m.mName);
         for (Struct &s : m.mStructs)
-            s.OnUpdateStructs(modules);
+            s.OnUpdateStructs(graph);
         unsigned int numModuleFunctions = m.mFunctions.size();
         unsigned int numModuleVariables = m.mVariables.size();
         unsigned int numModuleVirtualFunctions = 0;
@@ -580,9 +1091,17 @@ void Generator::UpdateModules(List<Module> &modules) {
         m.mHasSourceFile = numModuleFunctions > 0 || numModuleVariables > 0 || numModuleVirtualFunctions > 0;
         m.mHasMetaFile = numModuleFunctions > 0;
     }
+    // UsesCustomConstruction() caches its result in the struct and write order of structs is set here,
+    // so the model is not modified later, when modules are written from worker threads
+    for (Module &m : modules) {
+        for (Struct &s : m.mStructs)
+            s.UsesCustomConstruction();
+        m.SortStructs();
+    }
 }
 
-void Generator::ReadRelationsFile(path const &filepath, List<Module> &modules) {
+void Generator::ReadRelationsFile(path const &filepath, SymbolTable &symbols, TypeGraph const &graph) {
+    Trace::Scope traceScope("update", "ReadRelationsFile");
     ifstream file(filepath);
     if (!file.is_open()) {
         ErrorCode(0, "%s: Unable to open relations file", __FUNCTION__);
@@ -602,7 +1121,6 @@ void Generator::ReadRelationsFile(path const &filepath, List<Module> &modules) {
         string name1 = values[0];
         string name2 = values[2];
         bool findDerived1 = false, findDerived2 = false;
-        List<Struct *> derivedStructs1, derivedStructs2;
 
         if (String::EndsWith(name1, "^")) {
             name1.pop_back();
@@ -613,61 +1131,57 @@ void Generator::ReadRelationsFile(path const &filepath, List<Module> &modules) {
             findDerived2 = true;
         }
 
-        function<void(List<Struct *> &, Struct *)> CollectChildren = [&](List<Struct *> &structs, Struct *struc) {
-            structs.push_back(struc);
-            for (auto c : struc->mChilds)
-                CollectChildren(structs, c);
-        };
-
-        auto module1 = Module::Find(modules, name1);
-        if (module1 && findDerived1) {
-            auto struc = module1->FindStruct(name1);
-            if (struc) {
-                for (auto struc : struc->mChilds)
-                    CollectChildren(derivedStructs1, struc);
-            }
-        }
-        auto module2 = Module::Find(modules, name2);
-        if (module2 && findDerived2) {
-            auto struc = module2->FindStruct(name2);
-            if (struc) {
-                for (auto struc : struc->mChilds)
-                    CollectChildren(derivedStructs2, struc);
-            }
-        }
+        // modules of derived structs
+        ModuleSet derivedModules1, derivedModules2;
+        auto module1 = symbols.FindModule(name1);
+        if (module1 && findDerived1)
+            graph.CollectDescendantModules(module1->FindStruct(name1), derivedModules1);
+        auto module2 = symbols.FindModule(name2);
+        if (module2 && findDerived2)
+            graph.CollectDescendantModules(module2->FindStruct(name2), derivedModules2);
 
         enum class RelType { Required, Forbidden };
 
-        function<void(Module *, string const &, RelType)> AddRelationForOneModule = [](Module *m, string const &name, RelType rt) {
-            if (m)
-                if (rt == RelType::Required)
-                    m->mRequiredModules.insert(name);
-                else
-                    m->mForbiddenModules.insert(name);
-        };
-
-        auto AddRelation = [&](Module *m1, List<Struct *> &ds1, string const &n2, List<Struct *> &ds2, RelType rt) {
-            AddRelationForOneModule(m1, n2, rt);
-            for (auto s : ds1)
-                AddRelationForOneModule(s->mModule, n2, rt);
-            for (auto s2 : ds2) {
-                if (s2->mModule) {
-                    AddRelationForOneModule(m1, s2->mModule->mName, rt);
-                    for (auto s : ds1)
-                        AddRelationForOneModule(s->mModule, s2->mModule->mName, rt);
+        // relation is added to module m1 and to modules of structs derived from m1;
+        // relation target is n2 and modules of structs derived from n2
+        auto AddRelation = [&](Module *m1, ModuleSet const &dm1, string const &n2, ModuleSet const &dm2, RelType rt) {
+            ModuleSet targets = dm2;
+            Module *m2 = symbols.FindModule(n2);
+            if (m2)
+                targets.Insert(m2->mIndex);
+            unsigned long long relationHash = Hash::Get((rt == RelType::Required ? "+" : "-") + n2);
+            dm2.ForEach([&](unsigned int index) {
+                relationHash = Hash::Get(symbols.GetModule(index)->mName, relationHash);
+            });
+            auto AddRelationForOneModule = [&](Module *m) {
+                if (rt == RelType::Required) {
+                    m->mRequiredModules.Merge(targets);
+                    if (!m2 && find(m->mRequiredNames.begin(), m->mRequiredNames.end(), n2) == m->mRequiredNames.end())
+                        m->mRequiredNames.push_back(n2);
                 }
-            }
+                else {
+                    m->mForbiddenModules.Merge(targets);
+                    if (!m2)
+                        m->mForbiddenNames.insert(n2);
+                }
+                m->AddInputHash(relationHash);
+            };
+            if (m1)
+                AddRelationForOneModule(m1);
+            dm1.ForEach([&](unsigned int index) {
+                AddRelationForOneModule(symbols.GetModule(index));
+            });
         };
 
         if (rel == "=")
-            AddRelation(module1, derivedStructs1, name2, derivedStructs2, RelType::Required);
+            AddRelation(module1, derivedModules1, name2, derivedModules2, RelType::Required);
         else if (rel == ">")
-            AddRelation(module1, derivedStructs1, name2, derivedStructs2, RelType::Forbidden);
+            AddRelation(module1, derivedModules1, name2, derivedModules2, RelType::Forbidden);
         else if (rel == "<")
-            AddRelation(module2, derivedStructs2, name1, derivedStructs1, RelType::Forbidden);
+            AddRelation(module2, derivedModules2, name1, derivedModules1, RelType::Forbidden);
         else if (rel == "<>") {
-            AddRelation(module1, derivedStructs1, name2, derivedStructs2, RelType::Forbidden);
-            AddRelation(module2, derivedStructs2, name1, derivedStructs1, RelType::Forbidden);
+            AddRelation(module1, derivedModules1, name2, derivedModules2, RelType::Forbidden);
+            AddRelation(module2, derivedModules2, name1, derivedModules1, RelType::Forbidden);
         }
         else
             ErrorCode(0, "%s: Error in relations file:\n\"%s\"\nat line %u", __FUNCTION__, "Wrong relation type", lncounter);
@@ -2,16 +2,60 @@
 #include "ListEx.h"
 #include <filesystem>
 #include "Module.h"
+#include "TypeGraph.h"
+#include "Options.h"
+#include "JsonFileCache.h"
 #include "..\shared\Games.h"
+#include <sstream>
+#include <string_view>
 
 using namespace std;
 using namespace std::experimental::filesystem;
 
+// Object model of one game, passed from one generation stage to the next one
+class GameData {
+public:
+    Games::IDs mGame;
+    Arena mArena; // declared first - it must outlive all lists of the game
+    Arena *mActiveArena; // mArena, nullptr with --no-arena
+    List<Module> mModules;
+    SymbolTable mSymbols;
+    TypeGraph mGraph;
+    ostringstream mLog; // used in pipelined mode, printed when the game is written
+    JsonFileCache *mJsonCache = nullptr; // decoded files from previous runs (--watch)
+
+    GameData(Games::IDs game, bool useArena) : mGame(game), mActiveArena(useArena ? &mArena : nullptr),
+        mModules(ArenaAllocator<Module>(mActiveArena)) {}
+};
+
 class Generator {
 public:
-    static void Generate(path const &sdkpath);
-    static void ReadGame(List<Module> &modules, path const &sdkpath, Games::IDs game);
-    static void WriteModules(path const &sdkpath, Games::IDs game, List<Module> &modules);
-    static void UpdateModules(List<Module> &modules);
-    static void ReadRelationsFile(path const &filepath, List<Module> &modules);
+    static void Generate(path const &sdkpath, Options const &options);
+    static void GenerateGame(path const &sdkpath, Games::IDs game, Options const &options);
+    static void GeneratePipelined(path const &sdkpath, Options const &options);
+    static void ReadStage(path const &sdkpath, GameData &data, Options const &options); // read database or snapshot
+    static void UpdateStage(path const &sdkpath, GameData &data, Options const &options); // update structs and relations
+    static void WriteStage(path const &sdkpath, GameData &data, Options const &options); // write modules and stats
+    static void ReadGame(List<Module> &modules, SymbolTable &symbols, path const &sdkpath, Games::IDs game, Options const &options,
+        JsonFileCache *cache = nullptr);
+    static Vector<path> GetJsonFiles(path const &folder);
+    static Vector<path> GetInputFiles(path const &sdkpath, Games::IDs game); // database files read by ReadGame()
+    static Module *FindOrAddModule(List<Module> &modules, SymbolTable &symbols, string const &name, Games::IDs game);
+    static bool ReadFileContent(path const &filepath, string &content);
+    static void ReadEnumFile(path const &filepath, Enum &e, unsigned long long &fileHash);
+    static void ReadStructFile(path const &filepath, Struct &s, unsigned long long &fileHash);
+    // csv line decoding, false - line is skipped
+    static bool ReadVariableLine(string_view csvLine, JsonFileCache::VariableLine &line);
+    static bool ReadFunctionLine(string_view csvLine, JsonFileCache::FunctionLine &line);
+    static bool ReadVariableReferenceLine(string_view csvLine, JsonFileCache::ReferenceLine &line);
+    static bool ReadFunctionReferenceLine(string_view csvLine, JsonFileCache::ReferenceLine &line);
+    static bool ReadReferenceAddresses(string const &baseAddress, JsonFileCache::ReferenceLine &line);
+    static void AddInputHash(SymbolTable &symbols, string const &moduleName, string const &data);
+    static unordered_map<unsigned int, Variable *> BuildVariablesIndex(List<Module> &modules);
+    static unordered_map<unsigned int, Function *> BuildFunctionsIndex(List<Module> &modules);
+    static void ReportMissingAddresses(string const &entityType, Vector<unsigned int> const &addresses);
+    static void WriteModules(path const &sdkpath, Games::IDs game, List<Module> &modules, Options const &options);
+    static unsigned long long GetModuleHash(Module &m); // hash of module inputs and inputs of modules it depends on
+    static void UpdateModules(List<Module> &modules, SymbolTable &symbols, TypeGraph &graph);
+    static void ReadRelationsFile(path const &filepath, SymbolTable &symbols, TypeGraph const &graph);
 };
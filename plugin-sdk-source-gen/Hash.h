@@ -0,0 +1,30 @@
+#pragma once
+#include <string>
+#include <string_view>
+
+using namespace std;
+
+// 64-bit FNV-1a hash
+class Hash {
+public:
+    static const unsigned long long Basis = 14695981039346656037ull;
+    static const unsigned long long Prime = 1099511628211ull;
+
+    static inline unsigned long long Get(void const *data, size_t size, unsigned long long hash = Basis) {
+        auto bytes = reinterpret_cast<unsigned char const *>(data);
+        for (size_t i = 0; i < size; i++) {
+            hash ^= bytes[i];
+            hash *= Prime;
+        }
+        return hash;
+    }
+
+    static inline unsigned long long Get(string_view str, unsigned long long hash = Basis) {
+        return Get(str.data(), str.size(), hash);
+    }
+
+    // add value to hash (order-dependent)
+    static inline unsigned long long Combine(unsigned long long hash, unsigned long long value) {
+        return Get(&value, sizeof(value), hash);
+    }
+};
@@ -0,0 +1,8 @@
+#include "JsonFileCache.h"
+#include "Hash.h"
+
+unsigned long long JsonFileCache::GetFileStamp(path const &filepath) {
+    error_code ec;
+    unsigned long long stamp = Hash::Combine(Hash::Basis, file_size(filepath, ec));
+    return Hash::Combine(stamp, static_cast<unsigned long long>(last_write_time(filepath, ec).time_since_epoch().count()));
+}
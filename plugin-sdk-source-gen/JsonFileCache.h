@@ -0,0 +1,63 @@
+#pragma once
+#include <string>
+#include <unordered_map>
+#include <filesystem>
+#include "Enum.h"
+#include "Struct.h"
+#include "Variable.h"
+#include "Function.h"
+#include "ListEx.h"
+
+using namespace std;
+using namespace std::experimental::filesystem;
+
+// Decoded enum and struct files and decoded lines of csv files from previous runs (--watch). A file is parsed
+// again only when its size or modification time changes. Cached objects are allocated from the heap, not from game arena.
+class JsonFileCache {
+public:
+    template<typename T>
+    struct Entry {
+        unsigned long long mStamp = 0; // see GetFileStamp()
+        unsigned long long mHash = 0; // hash of file content
+        T mDecoded;
+    };
+
+    template<typename T>
+    using Map = unordered_map<string, Entry<T>>; // by file path
+
+    // line of base variables file
+    struct VariableLine {
+        string mModuleName;
+        unsigned long long mHash = 0; // hash of csv line
+        string mWarning; // not empty - wrong line, variable is not added
+        Variable mVariable;
+    };
+
+    // line of base functions file
+    struct FunctionLine {
+        string mModuleName;
+        unsigned long long mHash = 0; // hash of csv line
+        string mWarning; // not empty - wrong line, function is not added
+        string mClassScope; // scope of function class
+        Function mFunction;
+    };
+
+    // line of reference version file (variables or functions)
+    struct ReferenceLine {
+        unsigned int mBaseAddress = 0;
+        unsigned int mRefAddress = 0;
+        string mRefAddressStr; // as written in file
+        string mRefsList; // functions only
+    };
+
+    Map<Enum> mEnums;
+    Map<Struct> mStructs;
+    Map<Vector<VariableLine>> mVariables;
+    Map<Vector<FunctionLine>> mFunctions;
+    Map<Vector<ReferenceLine>> mVariableReferences;
+    Map<Vector<ReferenceLine>> mFunctionReferences;
+    unsigned int mNumParsed = 0; // json and csv files, for the last run
+    unsigned int mNumReused = 0;
+
+    static unsigned long long GetFileStamp(path const &filepath);
+};
@@ -1,11 +1,14 @@
 #pragma once
 #include <list>
+#include <memory>
 #include <vector>
 #include <functional>
 #include <unordered_set>
+#include "Arena.h"
 
+// list nodes are allocated from the active arena (see Arena::Scope)
 template<typename Item>
-using List = std::list<Item>;
+using List = std::list<Item, ArenaAllocator<Item>>;
 
 template<typename Item>
 using Vector = std::vector<Item>;
@@ -13,6 +16,25 @@ using Vector = std::vector<Item>;
 template<typename Item>
 using Set = std::unordered_set<Item>;
 
+// Immutable vector; copies share the same items
+
+template<typename Item>
+class SharedVector {
+    std::shared_ptr<std::vector<Item> const> mItems;
+public:
+    SharedVector() = default;
+    SharedVector(std::vector<Item> &&items) {
+        if (!items.empty())
+            mItems = std::make_shared<std::vector<Item> const>(std::move(items));
+    }
+    size_t size() const { return mItems ? mItems->size() : 0; }
+    bool empty() const { return !mItems; }
+    Item const &operator[](size_t index) const { return (*mItems)[index]; }
+    Item const &back() const { return mItems->back(); }
+    Item const *begin() const { return mItems ? mItems->data() : nullptr; }
+    Item const *end() const { return mItems ? mItems->data() + mItems->size() : nullptr; }
+};
+
 // Iterate list : for each element in range [_startIndex;_endIndex] call _callback()
 
 template<typename ListType>
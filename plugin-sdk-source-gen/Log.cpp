@@ -0,0 +1,14 @@
+#include "Log.h"
+#include <iostream>
+
+thread_local ostream *gLogStream = nullptr;
+
+ostream &Log::Out() {
+    if (gLogStream)
+        return *gLogStream;
+    return cout;
+}
+
+void Log::SetStream(ostream *stream) {
+    gLogStream = stream;
+}
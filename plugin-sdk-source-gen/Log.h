@@ -0,0 +1,10 @@
+#pragma once
+#include <ostream>
+
+using namespace std;
+
+class Log {
+public:
+    static ostream &Out(); // log stream of the current thread (cout by default)
+    static void SetStream(ostream *stream); // redirect log of the current thread (nullptr - back to cout)
+};
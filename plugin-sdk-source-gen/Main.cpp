@@ -1,12 +1,42 @@
 #include "..\shared\Utility.h"
 #include "Generator.h"
+#include "Options.h"
+#include "Trace.h"
+#include "Bench.h"
+#include "Verify.h"
+#include "Watch.h"
 #include <iostream>
 
+// usage:
+//     plugin-sdk-source-gen %PLUGIN_SDK_DIR% [--jobs N] [--incremental] [--stats] [--snapshot] [--no-arena] [--dump-graph] [--pipeline] [--trace out.json] [--verify <golden dir>] [--watch]
+//     plugin-sdk-source-gen %PLUGIN_SDK_DIR% --bench [--bench-structs N] [--bench-depth D] [--bench-functions M] [--bench-variables K] [--jobs N]
+//     plugin-sdk-source-gen %PLUGIN_SDK_DIR% --bench-csv [--bench-csv-rows N]
+
 int main(int argc, char *argv[]) {
     if (argc < 2)
         return ErrorCode(1, "Error: Not enough parameters (%d, expected 2)", argc);
     path sdkpath = argv[1]; // plugin-sdk folder;
-    Generator::Generate(sdkpath);
+    Options options;
+    if (!options.Parse(argc, argv, 2))
+        return 2;
+    if (options.mBench)
+        return Bench::Run(sdkpath, options) ? 0 : 3;
+    if (options.mBenchCsv)
+        return Bench::RunCsv(sdkpath, options) ? 0 : 3;
+    if (!options.mVerifyPath.empty())
+        return Verify::Run(sdkpath, options.mVerifyPath, options) ? 0 : 4;
+    if (options.mWatch) {
+        Watch::Run(sdkpath, options);
+        return 0;
+    }
+    if (!options.mTracePath.empty())
+        Trace::Enable();
+    Generator::Generate(sdkpath, options);
+    if (Trace::IsEnabled()) {
+        Trace::WriteSlowest(cout, "module", 10);
+        if (!Trace::Write(options.mTracePath))
+            return ErrorCode(3, "Error: Unable to write trace file '%s'", options.mTracePath.c_str());
+    }
 
     return 0;
 }
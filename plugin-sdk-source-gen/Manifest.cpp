@@ -0,0 +1,34 @@
+#include "Manifest.h"
+#include "OutputFile.h"
+#include <fstream>
+#include <sstream>
+
+bool Manifest::Read(path const &filepath) {
+    mModuleHashes.clear();
+    ifstream file(filepath);
+    if (!file.is_open())
+        return false;
+    string line;
+    if (!getline(file, line) || line != "# plugin-sdk-source-gen manifest " + to_string(Version))
+        return false;
+    while (getline(file, line)) {
+        istringstream ss(line);
+        string moduleName, hash;
+        if (ss >> moduleName >> hash)
+            mModuleHashes[moduleName] = stoull(hash, nullptr, 16);
+    }
+    return true;
+}
+
+bool Manifest::Write(path const &filepath) {
+    ostringstream stream;
+    stream << "# plugin-sdk-source-gen manifest " << Version << endl;
+    for (auto const &entry : mModuleHashes)
+        stream << entry.first << ' ' << hex << entry.second << dec << endl;
+    return OutputFile::Write(filepath, stream.str()) != OutputFile::Result::Error;
+}
+
+bool Manifest::IsUpToDate(string const &moduleName, unsigned long long hash) {
+    auto it = mModuleHashes.find(moduleName);
+    return it != mModuleHashes.end() && it->second == hash;
+}
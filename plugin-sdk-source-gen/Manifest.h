@@ -0,0 +1,19 @@
+#pragma once
+#include <string>
+#include <map>
+#include <filesystem>
+
+using namespace std;
+using namespace std::experimental::filesystem;
+
+// Generated modules manifest: input hash for each module written in previous run
+class Manifest {
+public:
+    static const unsigned int Version = 1; // increase when generator output changes
+
+    map<string, unsigned long long> mModuleHashes; // sorted by module name
+
+    bool Read(path const &filepath);
+    bool Write(path const &filepath);
+    bool IsUpToDate(string const &moduleName, unsigned long long hash);
+};
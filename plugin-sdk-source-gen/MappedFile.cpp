@@ -0,0 +1,65 @@
+#include "MappedFile.h"
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+MappedFile::MappedFile(path const &filepath) {
+#ifdef _WIN32
+    HANDLE file = CreateFileW(filepath.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return;
+    mFile = file;
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size))
+        return;
+    mSize = static_cast<size_t>(size.QuadPart);
+    if (mSize == 0) { // empty files can't be mapped
+        mIsOpen = true;
+        return;
+    }
+    mMapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mMapping)
+        return;
+    mData = static_cast<char const *>(MapViewOfFile(mMapping, FILE_MAP_READ, 0, 0, 0));
+    mIsOpen = mData != nullptr;
+#else
+    mFile = open(filepath.c_str(), O_RDONLY);
+    if (mFile == -1)
+        return;
+    struct stat st;
+    if (fstat(mFile, &st) != 0)
+        return;
+    mSize = static_cast<size_t>(st.st_size);
+    if (mSize == 0) {
+        mIsOpen = true;
+        return;
+    }
+    void *data = mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, mFile, 0);
+    if (data == MAP_FAILED)
+        return;
+    mData = static_cast<char const *>(data);
+    mIsOpen = true;
+#endif
+}
+
+MappedFile::~MappedFile() {
+#ifdef _WIN32
+    if (mData)
+        UnmapViewOfFile(mData);
+    if (mMapping)
+        CloseHandle(mMapping);
+    if (mFile)
+        CloseHandle(mFile);
+#else
+    if (mData)
+        munmap(const_cast<char *>(mData), mSize);
+    if (mFile != -1)
+        close(mFile);
+#endif
+}
@@ -0,0 +1,31 @@
+#pragma once
+#include <string_view>
+#include <filesystem>
+
+using namespace std;
+#ifdef _MSC_VER
+using namespace std::experimental::filesystem;
+#else // the non-Windows part is only built by tests/csv_scan_test.py
+using namespace std::filesystem;
+#endif
+
+// Read-only memory-mapped file
+class MappedFile {
+    char const *mData = nullptr;
+    size_t mSize = 0;
+    bool mIsOpen = false;
+#ifdef _WIN32
+    void *mFile = nullptr;
+    void *mMapping = nullptr;
+#else
+    int mFile = -1;
+#endif
+public:
+    MappedFile(path const &filepath);
+    ~MappedFile();
+    MappedFile(MappedFile const &) = delete;
+    MappedFile &operator=(MappedFile const &) = delete;
+
+    bool IsOpen() const { return mIsOpen; }
+    string_view View() const { return string_view(mData, mSize); }
+};
@@ -2,6 +2,8 @@
 #include "Module.h"
 #include <iostream>
 #include "Comments.h"
+#include "OutputFile.h"
+#include "Trace.h"
 #include "StringEx.h"
 #include <unordered_set>
 
@@ -15,29 +17,33 @@ Module *Module::Find(List<Module> &modules, string const &name) {
 }
 
 Struct *Module::FindStruct(string const &name, bool bFullName) {
-    for (auto &s : mStructs) {
-        string structName;
-        if (bFullName)
-            structName = s.GetFullName();
-        else
-            structName = s.mName;
-        if (structName == name)
-            return &s;
-    }
-    return nullptr;
+    auto &index = bFullName ? mStructsByFullName : mStructsByName;
+    auto it = index.find(name);
+    Struct *result = it != index.end() ? it->second : nullptr;
+    if (mSymbols)
+        mSymbols->CountLookup(result != nullptr);
+    return result;
 }
 
 Enum *Module::FindEnum(string const & name, bool bFullName) {
-    for (auto &e : mEnums) {
-        string enumName;
-        if (bFullName)
-            enumName = e.GetFullName();
-        else
-            enumName = e.mName;
-        if (enumName == name)
-            return &e;
-    }
-    return nullptr;
+    auto &index = bFullName ? mEnumsByFullName : mEnumsByName;
+    auto it = index.find(name);
+    Enum *result = it != index.end() ? it->second : nullptr;
+    if (mSymbols)
+        mSymbols->CountLookup(result != nullptr);
+    return result;
+}
+
+Enum *Module::AddEnum(Enum &&e) {
+    mEnums.push_back(move(e));
+    Enum *result = &mEnums.back();
+    AddEnumToIndex(result);
+    return result;
+}
+
+void Module::AddEnumToIndex(Enum *e) {
+    mEnumsByName.emplace(e->mName, e);
+    mEnumsByFullName.emplace(e->GetFullName(), e);
 }
 
 void AddScopeStruct(Module *m, string const &scope, Struct *struc) {
@@ -61,25 +67,83 @@ Struct *Module::AddEmptyStruct(string const &name, string const &scope) {
     s.mModule = this;
     mStructs.push_back(s);
     Struct *result = &mStructs.back();
+    AddStructToIndex(result);
     AddScopeStruct(this, scope, &mStructs.back());
     return result;
 }
 
-void Module::Write(path const &folder, List<Module> const &allModules, Games::IDs game) {
-    WriteHeader(folder, allModules, game);
-    if (mHasSourceFile)
-        WriteSource(folder, allModules, game);
-    if (mHasMetaFile)
-        WriteMeta(folder / "meta", allModules, game);
+void Module::AddStructToIndex(Struct *s) {
+    mStructsByName.emplace(s->mName, s);
+    mStructsByFullName.emplace(s->GetFullName(), s);
+    if (mSymbols)
+        mSymbols->AddStruct(s);
 }
 
-bool Module::WriteHeader(path const &folder, List<Module> const &allModules, Games::IDs game) {
-    path headerFilePath = folder / (mName + ".h");
-    ofstream stream(headerFilePath);
-    if (!stream.is_open()) {
-        Message("Unable to open header file '%s'", headerFilePath.string().c_str());
+void Module::AddInputHash(unsigned long long hash) {
+    mInputHash = Hash::Combine(mInputHash, hash);
+}
+
+bool Module::IsForbidden(string const &name) {
+    if (mForbiddenModules.Empty() && mForbiddenNames.empty())
+        return false;
+    Module *m = mSymbols ? mSymbols->FindModule(name) : nullptr;
+    if (m)
+        return mForbiddenModules.Contains(m->mIndex);
+    return mForbiddenNames.find(name) != mForbiddenNames.end();
+}
+
+bool Module::FilesExist(path const &folder) {
+    return exists(folder / (mName + ".h")) &&
+        (!mHasSourceFile || exists(folder / (mName + ".cpp"))) &&
+        (!mHasMetaFile || exists(folder / "meta" / ("meta." + mName + ".h")));
+}
+
+void Module::SortStructs() {
+    mWriteOrder.clear();
+    for (auto &s : mStructs)
+        mWriteOrder.push_back(&s);
+    // list sort, not std::sort: the comparison is not a strict weak ordering, so the order depends on the algorithm
+    mWriteOrder.sort([](Struct *s1, Struct *s2) {
+        return !s1->ContainsType(s2->mName, false);
+    });
+}
+
+bool Module::Write(path const &folder, List<Module> const &allModules, Games::IDs game) {
+    Trace::Scope headerTraceScope("file", "Header", mName);
+    bool result = WriteHeader(folder, allModules, game);
+    headerTraceScope.Stop();
+    if (mHasSourceFile) {
+        Trace::Scope traceScope("file", "Source", mName);
+        if (!WriteSource(folder, allModules, game))
+            result = false;
+    }
+    if (mHasMetaFile) {
+        Trace::Scope traceScope("file", "Meta", mName);
+        if (!WriteMeta(folder / "meta", allModules, game))
+            result = false;
+    }
+    return result;
+}
+
+bool Module::WriteFile(path const &filepath, CodeStream const &stream, char const *fileType) {
+    mNumOutputBytes += stream.str().size();
+    mNumOutputNewLines += stream.GetNumNewLines();
+    switch (OutputFile::Write(filepath, stream.str())) {
+    case OutputFile::Result::Written:
+        mNumWrittenFiles++;
+        return true;
+    case OutputFile::Result::Unchanged:
+        mNumUnchangedFiles++;
+        return true;
+    default:
+        Message("Unable to write %s file '%s'", fileType, filepath.string().c_str());
         return false;
     }
+}
+
+bool Module::WriteHeader(path const &folder, List<Module> const &allModules, Games::IDs game) {
+    path headerFilePath = folder / (mName + ".h");
+    CodeStream stream;
     tabs t(0);
     // file header
     stream << GetPluginSdkComment(game, true) << endl;
@@ -90,7 +154,7 @@ bool Module::WriteHeader(path const &folder, List<Module> const &allModules, Gam
     vector<pair<string, bool>> usedTypes;
 
     auto addUsedTypeName = [&](string const &typeName, bool needsHeader = true) {
-        if (mForbiddenModules.find(typeName) != mForbiddenModules.end())
+        if (IsForbidden(typeName))
             needsHeader = false;
         bool found = false;
         for (auto &e : usedTypes) {
@@ -170,7 +234,10 @@ bool Module::WriteHeader(path const &folder, List<Module> const &allModules, Gam
     }
 
     // required modules
-    for (auto &req : mRequiredModules)
+    mRequiredModules.ForEach([&](unsigned int index) {
+        addUsedTypeName(mSymbols->GetModule(index)->mName);
+    });
+    for (auto &req : mRequiredNames)
         addUsedTypeName(req);
 
     // print include headers
@@ -195,12 +262,6 @@ bool Module::WriteHeader(path const &folder, List<Module> const &allModules, Gam
     if (numForwardDeclarations > 0)
         stream << endl;
 
-    if (mStructs.size() > 0) {
-        mStructs.sort([](Struct &s1, Struct &s2) {
-            return !s1.ContainsType(s2.mName, false);
-        });
-    }
-
     bool makeNewLine = true;
     // enums
     for (auto &e : mEnums) {
@@ -211,10 +272,10 @@ bool Module::WriteHeader(path const &folder, List<Module> const &allModules, Gam
         }
     }
     // structs
-    for (auto &s : mStructs) {
-        if (!s.mIsAnonymous && !s.mEncloseClass) {
+    for (Struct *s : mWriteOrder) {
+        if (!s->mIsAnonymous && !s->mEncloseClass) {
             stream << endl;
-            s.Write(stream, t, *this, allModules, game);
+            s->Write(stream, t, *this, allModules, game);
             stream << endl;
         }
     }
@@ -241,29 +302,25 @@ bool Module::WriteHeader(path const &folder, List<Module> const &allModules, Gam
     }
     makeNewLine = true;
     // structs extra info
-    for (auto &s : mStructs) {
-        if (!s.mIsAnonymous && (s.mHasVTable || s.mSize > 0)) {
+    for (Struct *s : mWriteOrder) {
+        if (!s->mIsAnonymous && (s->mHasVTable || s->mSize > 0)) {
             if (makeNewLine) {
                 stream << endl;
                 makeNewLine = false;
             }
-            s.WriteStructExtraInfo(stream);
+            s->WriteStructExtraInfo(stream);
         }
     }
 
     if (mHasMetaFile)
         stream << endl << "#include " << '"' << "meta/meta." << mName + ".h" << '"' << endl;
 
-    return true;
+    return WriteFile(headerFilePath, stream, "header");
 }
 
 bool Module::WriteSource(path const &folder, List<Module> const &allModules, Games::IDs game) {
     path sourceFilePath = folder / (mName + ".cpp");
-    ofstream stream(sourceFilePath);
-    if (!stream.is_open()) {
-        Message("Unable to open source file '%s'", sourceFilePath.string().c_str());
-        return false;
-    }
+    CodeStream stream;
     tabs t(0);
     // file header
     stream << GetPluginSdkComment(game, false) << endl;
@@ -274,8 +331,8 @@ bool Module::WriteSource(path const &folder, List<Module> const &allModules, Gam
 
     unsigned int numWrittenVars = 0;
     // class variables
-    for (auto &s : mStructs) {
-        for (auto &v : s.mVariables) {
+    for (Struct *s : mWriteOrder) {
+        for (auto &v : s->mVariables) {
             v.WriteDefinition(stream, t, game);
             stream << endl;
             numWrittenVars++;
@@ -289,8 +346,8 @@ bool Module::WriteSource(path const &folder, List<Module> const &allModules, Gam
     }
     int numWrittenFuncs = 0;
     // class functions
-    for (auto &s : mStructs)
-        numWrittenFuncs += s.WriteFunctions(stream, t, game, true, false, numWrittenFuncs > 0 || numWrittenVars > 0);
+    for (Struct *s : mWriteOrder)
+        numWrittenFuncs += s->WriteFunctions(stream, t, game, true, false, numWrittenFuncs > 0 || numWrittenVars > 0);
     //functions
     for (auto &f : mFunctions) {
         if (numWrittenFuncs > 0 || numWrittenVars > 0)
@@ -299,16 +356,12 @@ bool Module::WriteSource(path const &folder, List<Module> const &allModules, Gam
         stream << endl;
         numWrittenFuncs++;
     }
-    return true;
+    return WriteFile(sourceFilePath, stream, "source");
 }
 
 bool Module::WriteMeta(path const &folder, List<Module> const &allModules, Games::IDs game) {
     path metaFilePath = folder / ("meta." + mName + ".h");
-    ofstream stream(metaFilePath);
-    if (!stream.is_open()) {
-        Message("Unable to open meta file '%s'", metaFilePath.string().c_str());
-        return false;
-    }
+    CodeStream stream;
     tabs t(0);
     // file header
     stream << GetPluginSdkComment(game, true) << endl;
@@ -317,18 +370,18 @@ bool Module::WriteMeta(path const &folder, List<Module> const &allModules, Games
     stream << endl;
     stream << "namespace plugin {" << endl;
     // class functions
-    for (auto &s : mStructs)
-        s.WriteFunctions(stream, t, game, false, true, true);
+    for (Struct *s : mWriteOrder)
+        s->WriteFunctions(stream, t, game, false, true, true);
     //functions
     for (auto &f : mFunctions) {
         stream << endl;
         f.WriteMeta(stream, t, game);
         stream << endl;
     }
-    for (auto &s : mStructs)
-        s.WriteGeneratedConstruction(stream, t, game);
+    for (Struct *s : mWriteOrder)
+        s->WriteGeneratedConstruction(stream, t, game);
     stream << endl << "}" << endl;
-    return true;
+    return WriteFile(metaFilePath, stream, "meta");
 }
 
 void Module::AddFunction(Function const &fn) {
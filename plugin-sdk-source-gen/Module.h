@@ -8,24 +8,46 @@
 #include "Function.h"
 #include "..\shared\Games.h"
 #include "ListEx.h"
+#include "SymbolTable.h"
+#include "ModuleSet.h"
+#include "Hash.h"
+#include "CodeStream.h"
+#include <unordered_map>
 
 using namespace std;
 using namespace std::experimental::filesystem;
 
 class Module {
+    // name indices for FindStruct() and FindEnum(), the first added struct/enum wins
+    unordered_map<string, Struct *> mStructsByName;
+    unordered_map<string, Struct *> mStructsByFullName;
+    unordered_map<string, Enum *> mEnumsByName;
+    unordered_map<string, Enum *> mEnumsByFullName;
 public:
     Games::IDs mGame;
     string mName;
+    unsigned int mIndex = 0; // position in modules list
+    SymbolTable *mSymbols = nullptr; // symbol table of the current run
+    unsigned long long mInputHash = Hash::Basis; // hash of database entries for this module
     List<Enum> mEnums;
     List<Struct> mStructs;
     List<Variable> mVariables;
     List<Function> mFunctions;
+    List<Struct *> mWriteOrder; // mStructs in the order they are written, see SortStructs()
 
     bool mHasSourceFile = false;
     bool mHasMetaFile = false;
 
-    Set<string> mRequiredModules;
-    Set<string> mForbiddenModules;
+    // relations from module_relations.txt; names which are not modules are kept as strings
+    ModuleSet mRequiredModules;
+    ModuleSet mForbiddenModules;
+    Vector<string> mRequiredNames;
+    Set<string> mForbiddenNames;
+
+    unsigned int mNumWrittenFiles = 0;
+    unsigned int mNumUnchangedFiles = 0;
+    unsigned long long mNumOutputBytes = 0; // size of generated files
+    unsigned int mNumOutputNewLines = 0; // new lines written without flush
 
     List<string> mErrors;
     List<string> mWarnings;
@@ -34,9 +56,18 @@ public:
     Struct *FindStruct(string const &name, bool bFullName = false);
     Enum *FindEnum(string const &name, bool bFullName = false);
     Struct *AddEmptyStruct(string const &name, string const &scope);
+    Enum *AddEnum(Enum &&e);
+    void AddStructToIndex(Struct *s); // for structs added to mStructs directly
+    void AddEnumToIndex(Enum *e); // for enums added to mEnums directly
     void AddFunction(Function const &fn);
 
-    void Write(path const &folder, List<Module> const &allModules, Games::IDs game);
+    void AddInputHash(unsigned long long hash);
+    bool IsForbidden(string const &name);
+    bool FilesExist(path const &folder);
+    void SortStructs(); // sets mWriteOrder, called before modules are written
+
+    bool Write(path const &folder, List<Module> const &allModules, Games::IDs game);
+    bool WriteFile(path const &filepath, CodeStream const &stream, char const *fileType);
     bool WriteHeader(path const &folder, List<Module> const &allModules, Games::IDs game);
     bool WriteSource(path const &folder, List<Module> const &allModules, Games::IDs game);
     bool WriteMeta(path const &folder, List<Module> const &allModules, Games::IDs game);
@@ -0,0 +1,45 @@
+#pragma once
+#include "ListEx.h"
+
+// Set of modules of one game, as bits indexed by Module::mIndex
+class ModuleSet {
+    Vector<unsigned long long> mBits;
+public:
+    void Insert(unsigned int index) {
+        if (index / 64 >= mBits.size())
+            mBits.resize(index / 64 + 1);
+        mBits[index / 64] |= 1ull << (index % 64);
+    }
+
+    bool Contains(unsigned int index) const {
+        return index / 64 < mBits.size() && (mBits[index / 64] & (1ull << (index % 64))) != 0;
+    }
+
+    void Merge(ModuleSet const &rhs) {
+        if (rhs.mBits.size() > mBits.size())
+            mBits.resize(rhs.mBits.size());
+        for (size_t i = 0; i < rhs.mBits.size(); i++)
+            mBits[i] |= rhs.mBits[i];
+    }
+
+    bool Empty() const {
+        for (auto bits : mBits) {
+            if (bits)
+                return false;
+        }
+        return true;
+    }
+
+    // call callback(index) for each module, in module order
+    template<typename Callback>
+    void ForEach(Callback callback) const {
+        for (size_t i = 0; i < mBits.size(); i++) {
+            if (mBits[i]) {
+                for (unsigned int bit = 0; bit < 64; bit++) {
+                    if (mBits[i] & (1ull << bit))
+                        callback(static_cast<unsigned int>(i * 64 + bit));
+                }
+            }
+        }
+    }
+};
@@ -0,0 +1,70 @@
+#include "..\shared\Utility.h"
+#include "Options.h"
+#include "StringEx.h"
+
+bool Options::Parse(int argc, char *argv[], int startIndex) {
+    for (int i = startIndex; i < argc; i++) {
+        string arg = argv[i];
+        auto ReadNumber = [&](unsigned int &value) {
+            if (i + 1 >= argc || !String::IsNumber(argv[i + 1]))
+                return Message("Error: '%s' option requires a number", arg.c_str());
+            value = String::ToNumber(argv[++i]);
+            return true;
+        };
+        if (arg == "--jobs" || arg == "-j") {
+            if (!ReadNumber(mJobs))
+                return false;
+        }
+        else if (arg == "--incremental")
+            mIncremental = true;
+        else if (arg == "--stats")
+            mStats = true;
+        else if (arg == "--snapshot")
+            mSnapshot = true;
+        else if (arg == "--no-arena")
+            mArena = false;
+        else if (arg == "--dump-graph")
+            mDumpGraph = true;
+        else if (arg == "--pipeline")
+            mPipeline = true;
+        else if (arg == "--trace") {
+            if (i + 1 >= argc)
+                return Message("Error: '%s' option requires a file path", arg.c_str());
+            mTracePath = argv[++i];
+        }
+        else if (arg == "--verify") {
+            if (i + 1 >= argc)
+                return Message("Error: '%s' option requires a folder path", arg.c_str());
+            mVerifyPath = argv[++i];
+        }
+        else if (arg == "--watch")
+            mWatch = true;
+        else if (arg == "--bench")
+            mBench = true;
+        else if (arg == "--bench-structs") {
+            if (!ReadNumber(mBenchStructs))
+                return false;
+        }
+        else if (arg == "--bench-depth") {
+            if (!ReadNumber(mBenchDepth))
+                return false;
+        }
+        else if (arg == "--bench-functions") {
+            if (!ReadNumber(mBenchFunctions))
+                return false;
+        }
+        else if (arg == "--bench-variables") {
+            if (!ReadNumber(mBenchVariables))
+                return false;
+        }
+        else if (arg == "--bench-csv")
+            mBenchCsv = true;
+        else if (arg == "--bench-csv-rows") {
+            if (!ReadNumber(mBenchCsvRows))
+                return false;
+        }
+        else
+            return Message("Error: Unknown option '%s'", arg.c_str());
+    }
+    return true;
+}
@@ -0,0 +1,27 @@
+#pragma once
+#include <string>
+
+using namespace std;
+
+class Options {
+public:
+    unsigned int mJobs = 1; // number of worker threads (--jobs N, 0 - use all cores)
+    bool mIncremental = false; // write only modules changed since previous run (--incremental)
+    bool mStats = false; // print lookup and output statistics (--stats)
+    bool mArena = true; // allocate the object model from per-game arena (disabled with --no-arena)
+    bool mSnapshot = false; // load the database from binary snapshot if it is up to date (--snapshot)
+    bool mDumpGraph = false; // write type graph to generated/graph.<game>.dot and .json (--dump-graph)
+    bool mPipeline = false; // read, update and write games in pipeline stages (--pipeline)
+    string mTracePath; // write Chrome trace of generation phases to this file (--trace out.json)
+    string mVerifyPath; // compare generated modules with this folder instead of writing them (--verify <golden dir>)
+    bool mWatch = false; // generate again when database files change (--watch)
+    bool mBench = false; // generate synthetic database and measure generation phases (--bench)
+    unsigned int mBenchStructs = 1000; // number of synthetic structs per game (--bench-structs N)
+    unsigned int mBenchDepth = 4; // inheritance depth of synthetic structs (--bench-depth D)
+    unsigned int mBenchFunctions = 10000; // number of synthetic functions per game (--bench-functions M)
+    unsigned int mBenchVariables = 2000; // number of synthetic variables per game (--bench-variables K)
+    bool mBenchCsv = false; // time csv readers on synthetic functions file (--bench-csv)
+    unsigned int mBenchCsvRows = 100000; // number of rows in synthetic csv file (--bench-csv-rows N)
+
+    bool Parse(int argc, char *argv[], int startIndex);
+};
@@ -0,0 +1,80 @@
+#include "OutputFile.h"
+#include <fstream>
+#include <cstring>
+#ifdef _WIN32
+#define NOMINMAX
+#include <Windows.h>
+#endif
+
+bool OutputFile::mCapture = false;
+map<path, string> OutputFile::mCapturedFiles;
+mutex OutputFile::mCaptureMutex;
+
+OutputFile::Result OutputFile::Write(path const &filepath, string const &data) {
+    bool isSame = IsSame(filepath, data);
+    if (mCapture) {
+        lock_guard<mutex> lock(mCaptureMutex);
+        mCapturedFiles[filepath] = data;
+        return isSame ? Result::Unchanged : Result::Written;
+    }
+    if (isSame)
+        return Result::Unchanged;
+    path tempFilePath = filepath;
+    tempFilePath += ".tmp";
+    {
+        ofstream file(tempFilePath, ios::binary);
+        if (!file.is_open())
+            return Result::Error;
+        file.write(data.data(), data.size());
+        file.close();
+        if (file.fail()) {
+            error_code ec;
+            remove(tempFilePath, ec);
+            return Result::Error;
+        }
+    }
+#ifdef _WIN32
+    // std rename doesn't replace existing files on Windows
+    if (!MoveFileExW(tempFilePath.wstring().c_str(), filepath.wstring().c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH)) {
+        error_code ec;
+        remove(tempFilePath, ec);
+        return Result::Error;
+    }
+#else
+    error_code ec;
+    rename(tempFilePath, filepath, ec);
+    if (ec) {
+        remove(tempFilePath, ec);
+        return Result::Error;
+    }
+#endif
+    return Result::Written;
+}
+
+bool OutputFile::IsSame(path const &filepath, string const &data) {
+    error_code ec;
+    auto size = file_size(filepath, ec);
+    if (ec || size != data.size())
+        return false;
+    ifstream file(filepath, ios::binary);
+    if (!file.is_open())
+        return false;
+    const size_t chunkSize = 64 * 1024;
+    char buf[chunkSize];
+    for (size_t offset = 0; offset < data.size(); offset += chunkSize) {
+        size_t count = min(chunkSize, data.size() - offset);
+        if (!file.read(buf, count) || memcmp(buf, data.data() + offset, count))
+            return false;
+    }
+    return true;
+}
+
+void OutputFile::StartCapture() {
+    mCapturedFiles.clear();
+    mCapture = true;
+}
+
+map<path, string> OutputFile::StopCapture() {
+    mCapture = false;
+    return move(mCapturedFiles);
+}
@@ -0,0 +1,27 @@
+#pragma once
+#include <string>
+#include <filesystem>
+#include <map>
+#include <mutex>
+
+using namespace std;
+using namespace std::experimental::filesystem;
+
+// Writes generated files only when their content changes, so unchanged files keep their timestamps
+class OutputFile {
+public:
+    enum class Result { Written, Unchanged, Error };
+
+    // file is replaced atomically: data is written to a temp file, which is then moved over the target
+    // (MoveFileEx with MOVEFILE_REPLACE_EXISTING on Windows, rename elsewhere)
+    static Result Write(path const &filepath, string const &data);
+    static bool IsSame(path const &filepath, string const &data);
+
+    // while capture is active, Write() keeps files in memory and doesn't touch the disk (--verify)
+    static void StartCapture();
+    static map<path, string> StopCapture();
+private:
+    static bool mCapture;
+    static map<path, string> mCapturedFiles;
+    static mutex mCaptureMutex;
+};
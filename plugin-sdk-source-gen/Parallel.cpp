@@ -0,0 +1,35 @@
+#include "Parallel.h"
+#include "ListEx.h"
+#include <thread>
+#include <atomic>
+
+unsigned int Parallel::GetNumThreads(unsigned int jobs) {
+    if (jobs == 0) {
+        jobs = thread::hardware_concurrency();
+        if (jobs == 0)
+            jobs = 1;
+    }
+    return jobs;
+}
+
+void Parallel::For(size_t count, unsigned int jobs, function<void(size_t)> callback) {
+    size_t numThreads = GetNumThreads(jobs);
+    if (numThreads > count)
+        numThreads = count;
+    if (numThreads <= 1) {
+        for (size_t i = 0; i < count; i++)
+            callback(i);
+        return;
+    }
+    atomic<size_t> nextIndex(0);
+    auto worker = [&]() {
+        for (size_t i = nextIndex++; i < count; i = nextIndex++)
+            callback(i);
+    };
+    Vector<thread> threads;
+    for (size_t t = 1; t < numThreads; t++)
+        threads.emplace_back(worker);
+    worker();
+    for (auto &t : threads)
+        t.join();
+}
@@ -0,0 +1,53 @@
+#pragma once
+#include <functional>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+
+using namespace std;
+
+class Parallel {
+public:
+    static unsigned int GetNumThreads(unsigned int jobs); // resolve --jobs value (0 - hardware threads)
+
+    // call _callback(index) for each index in range [0;count), using up to 'jobs' threads
+    static void For(size_t count, unsigned int jobs, function<void(size_t)> callback);
+};
+
+// Queue between two pipeline stages. Push() waits while the queue is full, Pop() waits while
+// it is empty; Pop() returns false when the queue is closed and all items were taken.
+template<typename T>
+class BoundedQueue {
+    deque<T> mItems;
+    size_t mCapacity;
+    bool mClosed = false;
+    mutex mMutex;
+    condition_variable mNotFull;
+    condition_variable mNotEmpty;
+public:
+    BoundedQueue(size_t capacity) : mCapacity(capacity) {}
+
+    void Push(T item) {
+        unique_lock<mutex> lock(mMutex);
+        mNotFull.wait(lock, [this] { return mItems.size() < mCapacity; });
+        mItems.push_back(move(item));
+        mNotEmpty.notify_one();
+    }
+
+    bool Pop(T &item) {
+        unique_lock<mutex> lock(mMutex);
+        mNotEmpty.wait(lock, [this] { return !mItems.empty() || mClosed; });
+        if (mItems.empty())
+            return false;
+        item = move(mItems.front());
+        mItems.pop_front();
+        mNotFull.notify_one();
+        return true;
+    }
+
+    void Close() {
+        lock_guard<mutex> lock(mMutex);
+        mClosed = true;
+        mNotEmpty.notify_all();
+    }
+};
@@ -20,6 +20,41 @@ public:
         return p;
     }
 
+    static inline path GetManifestPath(path const &sdkpath, Games::IDs game) {
+        path p = sdkpath / "generated";
+        if (!exists(p))
+            create_directories(p);
+        return p / ("manifest." + Games::GetGameFolder(game) + ".txt");
+    }
+
+    static inline path GetSnapshotPath(path const &sdkpath, Games::IDs game) {
+        path p = sdkpath / "generated";
+        if (!exists(p))
+            create_directories(p);
+        return p / ("snapshot." + Games::GetGameFolder(game) + ".bin");
+    }
+
+    static inline path GetGraphPath(path const &sdkpath, Games::IDs game, string const &extension) {
+        path p = sdkpath / "generated";
+        if (!exists(p))
+            create_directories(p);
+        return p / ("graph." + Games::GetGameFolder(game) + extension);
+    }
+
+    static inline path GetBenchPath(path const &sdkpath) {
+        path p = sdkpath / "generated";
+        if (!exists(p))
+            create_directories(p);
+        return p / "bench.json";
+    }
+
+    static inline path GetBenchCsvPath(path const &sdkpath) {
+        path p = sdkpath / "generated";
+        if (!exists(p))
+            create_directories(p);
+        return p / "bench.functions.csv";
+    }
+
     static inline path GetOtherDir(path const &sdkpath, Games::IDs game) {
         path p = sdkpath / "generated" / "other" / Games::GetGameFolder(game);
         if (!exists(p))
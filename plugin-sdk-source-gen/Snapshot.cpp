@@ -0,0 +1,500 @@
+#include "Snapshot.h"
+#include "Hash.h"
+#include "MappedFile.h"
+#include "OutputFile.h"
+#include <cstring>
+#include <type_traits>
+
+const char SnapshotMagic[8] = { 'P', 'S', 'G', 'S', 'N', 'A', 'P', 0 };
+
+class SnapshotWriter {
+public:
+    string mData;
+
+    template<typename T>
+    void Write(T value) {
+        static_assert(is_trivially_copyable_v<T>, "only plain values can be written");
+        mData.append(reinterpret_cast<char const *>(&value), sizeof(T));
+    }
+
+    void Write(string const &str) {
+        Write<unsigned int>(str.size());
+        mData.append(str);
+    }
+};
+
+class SnapshotReader {
+    string_view mData;
+    size_t mPos = 0;
+    bool mFailed = false;
+public:
+    SnapshotReader(string_view data) : mData(data) {}
+
+    bool Failed() const { return mFailed; }
+
+    template<typename T>
+    T Read() {
+        static_assert(is_trivially_copyable_v<T>, "only plain values can be read");
+        T value{};
+        if (mFailed || mPos + sizeof(T) > mData.size())
+            mFailed = true;
+        else {
+            memcpy(&value, mData.data() + mPos, sizeof(T));
+            mPos += sizeof(T);
+        }
+        return value;
+    }
+
+    void Read(string &str) {
+        unsigned int size = Read<unsigned int>();
+        if (mFailed || mPos + size > mData.size())
+            mFailed = true;
+        else {
+            str.assign(mData.data() + mPos, size);
+            mPos += size;
+        }
+    }
+
+    // read element count; fails if there's not enough data for 'count' elements
+    unsigned int ReadCount() {
+        unsigned int count = Read<unsigned int>();
+        if (count > mData.size() - mPos)
+            mFailed = true;
+        return mFailed ? 0 : count;
+    }
+};
+
+void WriteType(SnapshotWriter &w, Type const &t) {
+    w.Write(t.mName);
+    w.Write(t.mIsNumber);
+    w.Write(t.mIsEllipsis);
+    w.Write(t.mIsVoid);
+    w.Write(t.mIsPointerToFixedSizeArray);
+    w.Write(t.mArraySize[0]);
+    w.Write(t.mArraySize[1]);
+    w.Write(t.mIsConst);
+    w.Write(t.mIsInBuilt);
+    w.Write(t.mIsCustom);
+    w.Write(t.mIsRenderWare);
+    w.Write(t.mPointers);
+    w.Write(t.mFunctionOrArrayPointers);
+    w.Write(t.mIsFunction);
+    w.Write(t.mFunctionCC);
+    w.Write<unsigned int>(t.mFunctionParams.size());
+    for (auto const &p : t.mFunctionParams)
+        WriteType(w, p);
+    w.Write(t.mFunctionRetType != nullptr);
+    if (t.mFunctionRetType)
+        WriteType(w, *t.mFunctionRetType);
+    w.Write(t.mIsTemplate);
+    w.Write<unsigned int>(t.mTemplateTypes.size());
+    for (auto const &tt : t.mTemplateTypes)
+        WriteType(w, tt);
+    w.Write(t.mWasSetFromRawType);
+    w.Write(t.mIsForwardDecl);
+    w.Write<unsigned int>(t.mDbgTokens.size());
+    for (auto const &token : t.mDbgTokens) {
+        w.Write(token.value);
+        w.Write(token.type);
+    }
+}
+
+void ReadType(SnapshotReader &r, Type &t) {
+    r.Read(t.mName);
+    t.mIsNumber = r.Read<bool>();
+    t.mIsEllipsis = r.Read<bool>();
+    t.mIsVoid = r.Read<bool>();
+    t.mIsPointerToFixedSizeArray = r.Read<bool>();
+    t.mArraySize[0] = r.Read<unsigned int>();
+    t.mArraySize[1] = r.Read<unsigned int>();
+    t.mIsConst = r.Read<bool>();
+    t.mIsInBuilt = r.Read<bool>();
+    t.mIsCustom = r.Read<bool>();
+    t.mIsRenderWare = r.Read<bool>();
+    r.Read(t.mPointers);
+    r.Read(t.mFunctionOrArrayPointers);
+    t.mIsFunction = r.Read<bool>();
+    t.mFunctionCC = r.Read<Type::FunctionCC>();
+    Vector<Type> functionParams(r.ReadCount());
+    for (auto &p : functionParams)
+        ReadType(r, p);
+    t.mFunctionParams = move(functionParams);
+    if (r.Read<bool>() && !r.Failed()) {
+        auto retType = make_shared<Type>();
+        ReadType(r, *retType);
+        t.mFunctionRetType = retType;
+    }
+    t.mIsTemplate = r.Read<bool>();
+    Vector<Type> templateTypes(r.ReadCount());
+    for (auto &tt : templateTypes)
+        ReadType(r, tt);
+    t.mTemplateTypes = move(templateTypes);
+    t.mWasSetFromRawType = r.Read<bool>();
+    t.mIsForwardDecl = r.Read<bool>();
+    Vector<Token> tokens(r.ReadCount());
+    for (auto &token : tokens) {
+        r.Read(token.value);
+        token.type = r.Read<Token::Type>();
+    }
+    t.mDbgTokens = move(tokens);
+}
+
+void WriteVariable(SnapshotWriter &w, Variable const &v) {
+    w.Write(v.mName);
+    w.Write(v.mMangledName);
+    w.Write(v.mScope);
+    w.Write(v.mModuleName);
+    WriteType(w, v.mType);
+    w.Write(v.mDefaultValues);
+    w.Write(v.mComment);
+    w.Write(v.mSize);
+    w.Write(v.mIsReadOnly);
+    for (auto const &vi : v.mVersionInfo)
+        w.Write(vi.mAddress);
+}
+
+void ReadVariable(SnapshotReader &r, Variable &v) {
+    r.Read(v.mName);
+    r.Read(v.mMangledName);
+    r.Read(v.mScope);
+    r.Read(v.mModuleName);
+    ReadType(r, v.mType);
+    r.Read(v.mDefaultValues);
+    r.Read(v.mComment);
+    v.mSize = r.Read<unsigned int>();
+    v.mIsReadOnly = r.Read<bool>();
+    for (auto &vi : v.mVersionInfo)
+        vi.mAddress = r.Read<unsigned int>();
+}
+
+void WriteFunction(SnapshotWriter &w, Function const &f) {
+    w.Write(f.mName);
+    w.Write(f.mMangledName);
+    w.Write(f.mScope);
+    w.Write(f.mFullClassName);
+    w.Write(f.mShortClassName);
+    w.Write(f.mModuleName);
+    w.Write(f.mCC);
+    WriteType(w, f.mRetType);
+    w.Write(f.mIsConst);
+    w.Write(f.mIsEllipsis);
+    w.Write(f.mIsOverloaded);
+    w.Write(f.mForceOverloadedMetaMacro);
+    w.Write(f.mIsStatic);
+    w.Write(f.mRVOParamIndex);
+    w.Write(f.mNumParamsToSkipForWrapper);
+    w.Write(f.mComment);
+    w.Write(f.mType);
+    w.Write(f.mPriority);
+    w.Write(f.mUsage);
+    w.Write(f.mVTableIndex);
+    w.Write(f.mIsVirtual);
+    w.Write(f.mHasWSParameters);
+    w.Write<unsigned int>(f.mParameters.size());
+    for (auto const &p : f.mParameters) {
+        w.Write(p.mName);
+        WriteType(w, p.mType);
+        w.Write(p.mDefValue);
+        w.Write(p.mWSType);
+    }
+    for (auto const &vi : f.mVersionInfo) {
+        w.Write(vi.mAddress);
+        w.Write(vi.mRefsStr);
+    }
+}
+
+void ReadFunction(SnapshotReader &r, Function &f) {
+    r.Read(f.mName);
+    r.Read(f.mMangledName);
+    r.Read(f.mScope);
+    r.Read(f.mFullClassName);
+    r.Read(f.mShortClassName);
+    r.Read(f.mModuleName);
+    f.mCC = r.Read<Function::CC>();
+    ReadType(r, f.mRetType);
+    f.mIsConst = r.Read<bool>();
+    f.mIsEllipsis = r.Read<bool>();
+    f.mIsOverloaded = r.Read<bool>();
+    f.mForceOverloadedMetaMacro = r.Read<bool>();
+    f.mIsStatic = r.Read<bool>();
+    f.mRVOParamIndex = r.Read<int>();
+    f.mNumParamsToSkipForWrapper = r.Read<int>();
+    r.Read(f.mComment);
+    r.Read(f.mType);
+    f.mPriority = r.Read<unsigned int>();
+    f.mUsage = r.Read<Function::Usage>();
+    f.mVTableIndex = r.Read<int>();
+    f.mIsVirtual = r.Read<bool>();
+    f.mHasWSParameters = r.Read<bool>();
+    f.mParameters.resize(r.ReadCount());
+    for (auto &p : f.mParameters) {
+        r.Read(p.mName);
+        ReadType(r, p.mType);
+        r.Read(p.mDefValue);
+        p.mWSType = r.Read<FunctionParameter::WSType>();
+    }
+    for (auto &vi : f.mVersionInfo) {
+        vi.mAddress = r.Read<unsigned int>();
+        r.Read(vi.mRefsStr);
+    }
+}
+
+template<typename T>
+int GetIndex(List<T> const &list, T const *item) {
+    if (!item)
+        return -1;
+    int index = 0;
+    for (auto const &i : list) {
+        if (&i == item)
+            return index;
+        index++;
+    }
+    return -1;
+}
+
+unsigned long long Snapshot::GetKey(Vector<path> const &inputFiles) {
+    // content hashes: same-size edits within timestamp resolution and copies which keep
+    // modification times still change the key
+    unsigned long long key = Hash::Combine(Hash::Basis, Version);
+    for (auto const &filepath : inputFiles) {
+        key = Hash::Get(filepath.string(), key);
+        MappedFile file(filepath);
+        if (file.IsOpen())
+            key = Hash::Combine(key, Hash::Get(file.View()));
+        else
+            key = Hash::Combine(key, 0); // missing file
+    }
+    return key;
+}
+
+bool Snapshot::Save(path const &filepath, unsigned long long key, List<Module> const &modules) {
+    SnapshotWriter w;
+    w.mData.append(SnapshotMagic, sizeof(SnapshotMagic));
+    w.Write(Version);
+    w.Write(key);
+    w.Write<unsigned int>(modules.size());
+    for (auto const &m : modules) {
+        w.Write(m.mName);
+        w.Write(m.mInputHash);
+        w.Write<unsigned int>(m.mEnums.size());
+        for (auto const &e : m.mEnums) {
+            w.Write(e.mName);
+            w.Write(e.mModuleName);
+            w.Write(e.mScope);
+            w.Write(e.mWidth);
+            w.Write(e.mIsClass);
+            w.Write(e.mIsHexademical);
+            w.Write(e.mIsSigned);
+            w.Write(e.mIsBitfield);
+            w.Write(e.mIsAnonymous);
+            w.Write(e.mUsedAsBitfieldMember);
+            w.Write(e.mStartWord);
+            w.Write(e.mComment);
+            w.Write<unsigned int>(e.mMembers.size());
+            for (auto const &em : e.mMembers) {
+                w.Write(em.mName);
+                w.Write(em.mValue);
+                w.Write(em.mComment);
+                w.Write(em.mBitWidth);
+            }
+        }
+        w.Write<unsigned int>(m.mStructs.size());
+        for (auto const &s : m.mStructs) {
+            w.Write(s.mName);
+            w.Write(s.mModuleName);
+            w.Write(s.mKind);
+            w.Write(s.mSize);
+            w.Write(s.mAlignment);
+            w.Write(s.mIsAnonymous);
+            w.Write(s.mIsCoreClass);
+            w.Write(s.mIsAbstractClass);
+            w.Write(s.mHasVTable);
+            w.Write(s.mHasVTableMember);
+            w.Write(s.mHasVectorDeletingDestructor);
+            w.Write(s.mVTableAddress);
+            w.Write(s.mVTableSize);
+            w.Write(s.mComment);
+            w.Write(s.mScope);
+            w.Write(s.mParentName);
+            // enclose and nested classes are in the same module
+            w.Write(GetIndex(m.mStructs, static_cast<Struct const *>(s.mEncloseClass)));
+            w.Write<unsigned int>(s.mNestedClasses.size());
+            for (auto nested : s.mNestedClasses)
+                w.Write(GetIndex(m.mStructs, static_cast<Struct const *>(nested)));
+            w.Write<unsigned int>(s.mMembers.size());
+            for (auto const &sm : s.mMembers) {
+                w.Write(sm.mName);
+                WriteType(w, sm.mType);
+                w.Write(sm.mOffset);
+                w.Write(sm.mSize);
+                w.Write(sm.mComment);
+                w.Write(sm.mIsBase);
+                w.Write(sm.mIsPadding);
+                w.Write(sm.mIsVTable);
+                w.Write(sm.mIsAnonymous);
+                w.Write(sm.mIsBitfield);
+                // bitfield enum is in the same module
+                w.Write(GetIndex(m.mEnums, static_cast<Enum const *>(sm.mBitfield)));
+            }
+            w.Write<unsigned int>(s.mVariables.size());
+            for (auto const &v : s.mVariables)
+                WriteVariable(w, v);
+            w.Write<unsigned int>(s.mFunctions.size());
+            for (auto const &f : s.mFunctions)
+                WriteFunction(w, f);
+        }
+        w.Write<unsigned int>(m.mVariables.size());
+        for (auto const &v : m.mVariables)
+            WriteVariable(w, v);
+        w.Write<unsigned int>(m.mFunctions.size());
+        for (auto const &f : m.mFunctions)
+            WriteFunction(w, f);
+        w.Write<unsigned int>(m.mWarnings.size());
+        for (auto const &warning : m.mWarnings)
+            w.Write(warning);
+        w.Write<unsigned int>(m.mErrors.size());
+        for (auto const &error : m.mErrors)
+            w.Write(error);
+    }
+    return OutputFile::Write(filepath, w.mData) != OutputFile::Result::Error;
+}
+
+template<typename T>
+T *GetByIndex(Vector<T *> const &items, int index) {
+    if (index < 0 || index >= static_cast<int>(items.size()))
+        return nullptr;
+    return items[index];
+}
+
+bool Snapshot::Load(path const &filepath, unsigned long long key, List<Module> &modules, SymbolTable &symbols, Games::IDs game) {
+    MappedFile file(filepath);
+    if (!file.IsOpen())
+        return false;
+    auto data = file.View();
+    if (data.size() < sizeof(SnapshotMagic) || memcmp(data.data(), SnapshotMagic, sizeof(SnapshotMagic)))
+        return false;
+    SnapshotReader r(data.substr(sizeof(SnapshotMagic)));
+    if (r.Read<unsigned int>() != Version || r.Read<unsigned long long>() != key)
+        return false;
+    List<Module> loadedModules;
+    unsigned int numModules = r.ReadCount();
+    for (unsigned int i = 0; i < numModules && !r.Failed(); i++) {
+        Module &m = loadedModules.emplace_back();
+        r.Read(m.mName);
+        m.mGame = game;
+        symbols.AddModule(&m);
+        m.mInputHash = r.Read<unsigned long long>();
+        Vector<Enum *> enums;
+        unsigned int numEnums = r.ReadCount();
+        for (unsigned int e = 0; e < numEnums && !r.Failed(); e++) {
+            Enum &en = m.mEnums.emplace_back();
+            r.Read(en.mName);
+            r.Read(en.mModuleName);
+            r.Read(en.mScope);
+            en.mWidth = r.Read<unsigned int>();
+            en.mIsClass = r.Read<bool>();
+            en.mIsHexademical = r.Read<bool>();
+            en.mIsSigned = r.Read<bool>();
+            en.mIsBitfield = r.Read<bool>();
+            en.mIsAnonymous = r.Read<bool>();
+            en.mUsedAsBitfieldMember = r.Read<bool>();
+            r.Read(en.mStartWord);
+            r.Read(en.mComment);
+            unsigned int numMembers = r.ReadCount();
+            for (unsigned int em = 0; em < numMembers && !r.Failed(); em++) {
+                EnumMember &member = en.mMembers.emplace_back();
+                r.Read(member.mName);
+                member.mValue = r.Read<int>();
+                r.Read(member.mComment);
+                member.mBitWidth = r.Read<int>();
+            }
+            m.AddEnumToIndex(&en);
+            enums.push_back(&en);
+        }
+        // structs are created first, links between them are set when all structs are loaded
+        Vector<Struct *> structs;
+        Vector<int> encloseIndices;
+        Vector<Vector<int>> nestedIndices;
+        unsigned int numStructs = r.ReadCount();
+        for (unsigned int si = 0; si < numStructs && !r.Failed(); si++) {
+            Struct &s = m.mStructs.emplace_back();
+            s.mModule = &m;
+            r.Read(s.mName);
+            r.Read(s.mModuleName);
+            s.mKind = r.Read<Struct::Kind>();
+            s.mSize = r.Read<unsigned int>();
+            s.mAlignment = r.Read<unsigned int>();
+            s.mIsAnonymous = r.Read<bool>();
+            s.mIsCoreClass = r.Read<bool>();
+            s.mIsAbstractClass = r.Read<bool>();
+            s.mHasVTable = r.Read<bool>();
+            s.mHasVTableMember = r.Read<bool>();
+            s.mHasVectorDeletingDestructor = r.Read<bool>();
+            s.mVTableAddress = r.Read<unsigned int>();
+            s.mVTableSize = r.Read<unsigned int>();
+            r.Read(s.mComment);
+            r.Read(s.mScope);
+            r.Read(s.mParentName);
+            encloseIndices.push_back(r.Read<int>());
+            auto &nested = nestedIndices.emplace_back(r.ReadCount());
+            for (auto &n : nested)
+                n = r.Read<int>();
+            unsigned int numMembers = r.ReadCount();
+            for (unsigned int smi = 0; smi < numMembers && !r.Failed(); smi++) {
+                StructMember &sm = s.mMembers.emplace_back();
+                r.Read(sm.mName);
+                ReadType(r, sm.mType);
+                sm.mOffset = r.Read<unsigned int>();
+                sm.mSize = r.Read<unsigned int>();
+                r.Read(sm.mComment);
+                sm.mIsBase = r.Read<bool>();
+                sm.mIsPadding = r.Read<bool>();
+                sm.mIsVTable = r.Read<bool>();
+                sm.mIsAnonymous = r.Read<bool>();
+                sm.mIsBitfield = r.Read<bool>();
+                sm.mBitfield = GetByIndex(enums, r.Read<int>());
+            }
+            unsigned int numVariables = r.ReadCount();
+            for (unsigned int v = 0; v < numVariables && !r.Failed(); v++)
+                ReadVariable(r, s.mVariables.emplace_back());
+            // functions are added in the same way as in ReadGame - this restores function lists of the struct
+            unsigned int numFunctions = r.ReadCount();
+            for (unsigned int f = 0; f < numFunctions && !r.Failed(); f++) {
+                Function fn;
+                ReadFunction(r, fn);
+                s.AddFunction(fn);
+            }
+            m.AddStructToIndex(&s);
+            structs.push_back(&s);
+        }
+        for (size_t si = 0; si < structs.size(); si++) {
+            structs[si]->mEncloseClass = GetByIndex(structs, encloseIndices[si]);
+            for (auto n : nestedIndices[si]) {
+                Struct *nested = GetByIndex(structs, n);
+                if (nested)
+                    structs[si]->mNestedClasses.push_back(nested);
+            }
+        }
+        unsigned int numVariables = r.ReadCount();
+        for (unsigned int v = 0; v < numVariables && !r.Failed(); v++)
+            ReadVariable(r, m.mVariables.emplace_back());
+        unsigned int numFunctions = r.ReadCount();
+        for (unsigned int f = 0; f < numFunctions && !r.Failed(); f++) {
+            Function fn;
+            ReadFunction(r, fn);
+            m.AddFunction(fn);
+        }
+        m.mWarnings.resize(r.ReadCount());
+        for (auto &warning : m.mWarnings)
+            r.Read(warning);
+        m.mErrors.resize(r.ReadCount());
+        for (auto &error : m.mErrors)
+            r.Read(error);
+    }
+    if (r.Failed()) {
+        symbols.Clear();
+        return false;
+    }
+    modules.splice(modules.end(), loadedModules);
+    return true;
+}
@@ -0,0 +1,22 @@
+#pragma once
+#include <filesystem>
+#include "ListEx.h"
+#include "Module.h"
+#include "..\shared\Games.h"
+
+using namespace std;
+using namespace std::experimental::filesystem;
+
+// Binary snapshot of the database model, as it is after Generator::ReadGame().
+// Pointers are stored as indices. The snapshot is valid while its key (hash of paths and
+// contents of the database files) matches.
+// The file is memory-mapped, but the model is still built from it: modules use lists and
+// strings from the game arena, so the snapshot data can't be used in place.
+class Snapshot {
+public:
+    static const unsigned int Version = 1; // increase when model or snapshot layout changes
+
+    static unsigned long long GetKey(Vector<path> const &inputFiles);
+    static bool Save(path const &filepath, unsigned long long key, List<Module> const &modules);
+    static bool Load(path const &filepath, unsigned long long key, List<Module> &modules, SymbolTable &symbols, Games::IDs game);
+};
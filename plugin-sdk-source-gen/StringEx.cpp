@@ -82,6 +82,16 @@ void String::Trim(string &str) {
         str = str.substr(0, end + 1);
 }
 
+string_view String::Trim(string_view str) {
+    size_t start = str.find_first_not_of(" \t\r\n");
+    if (start != string_view::npos)
+        str.remove_prefix(start);
+    size_t end = str.find_last_not_of(" \t\r\n");
+    if (end != string_view::npos)
+        str = str.substr(0, end + 1);
+    return str;
+}
+
 string String::ToUpper(string const &str) {
     string result;
     for (size_t i = 0; i < str.length(); i++)
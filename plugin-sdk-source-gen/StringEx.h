@@ -1,5 +1,6 @@
 #pragma once
 #include <string>
+#include <string_view>
 #include "ListEx.h"
 
 using namespace std;
@@ -18,6 +19,7 @@ public:
     static string ToLower(string const &str);
 
     static void Trim(string &str);
+    static string_view Trim(string_view str);
 
     template <typename T, typename t = enable_if_t<is_integral_v<T>>>
     static string ToHexString(T intVal, bool prefix = true) {
@@ -30,7 +32,7 @@ public:
 
     template<typename ...ArgTypes>
     static string Format(const string &format, ArgTypes... args) {
-        static char buf[1024];
+        char buf[1024]; // local buffer - Format() is called from several threads
         snprintf(buf, 1024, format.c_str(), args...);
         return buf;
     }
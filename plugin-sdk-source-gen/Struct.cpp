@@ -2,9 +2,11 @@
 #include "Comments.h"
 #include "StringEx.h"
 #include "Module.h"
+#include "TypeGraph.h"
+#include "Trace.h"
 #include "GameVersions.h"
 
-void SetAccess(ofstream &stream, tabs t, Struct::Access &accessVar, Struct::Access newAccess) {
+void SetAccess(CodeStream &stream, tabs t, Struct::Access &accessVar, Struct::Access newAccess) {
     if (accessVar != newAccess) {
         if (t.count() > 0)
             t--;
@@ -20,7 +22,7 @@ void SetAccess(ofstream &stream, tabs t, Struct::Access &accessVar, Struct::Acce
     }
 }
 
-void Struct::Write(ofstream &stream, tabs t, Module &myModule, List<Module> const &allModules, Games::IDs game) {
+void Struct::Write(CodeStream &stream, tabs t, Module &myModule, List<Module> const &allModules, Games::IDs game) {
     WriteComment(stream, mComment, t, 0);
     
     bool isPacked = (mSize % 4) != 0;
@@ -145,7 +147,7 @@ void Struct::Write(ofstream &stream, tabs t, Module &myModule, List<Module> cons
         stream << endl << t() << "#pragma pack(pop)";
 }
 
-void StartFunction(ofstream &stream, unsigned int &numWrittenFunctions, bool definitions, bool metadata, bool makeNewLine) {
+void StartFunction(CodeStream &stream, unsigned int &numWrittenFunctions, bool definitions, bool metadata, bool makeNewLine) {
     if (numWrittenFunctions == 0) {
         if (makeNewLine)
             stream << endl;
@@ -154,13 +156,17 @@ void StartFunction(ofstream &stream, unsigned int &numWrittenFunctions, bool def
         stream << endl;
 }
 
-void EndFunction(ofstream &stream, unsigned int &numWrittenFunctions) {
+void EndFunction(CodeStream &stream, unsigned int &numWrittenFunctions) {
     stream << endl;
     numWrittenFunctions++;
 }
 
-void WriteOneFunction(Function *fn, ofstream &stream, tabs t, Games::IDs game, unsigned int &numWrittenFunctions,
-    bool definitions, bool metadata, bool makeNewLine, Function::Flags flags = Function::Flags())
+// functions already written by the current WriteFunctions() call; this is writer state, so modules
+// can be written from several threads (the model is not modified while writing)
+using WrittenFunctions = Set<Function const *>;
+
+void WriteOneFunction(Function *fn, CodeStream &stream, tabs t, Games::IDs game, unsigned int &numWrittenFunctions,
+    WrittenFunctions &written, bool definitions, bool metadata, bool makeNewLine, Function::Flags flags = Function::Flags())
 {
     StartFunction(stream, numWrittenFunctions, definitions, metadata, makeNewLine);
     if (metadata)
@@ -169,11 +175,11 @@ void WriteOneFunction(Function *fn, ofstream &stream, tabs t, Games::IDs game, u
         fn->WriteDefinition(stream, t, game, flags);
     else
         fn->WriteDeclaration(stream, t, game, flags);
-    fn->mWrittenToSource = true;
+    written.insert(fn);
     EndFunction(stream, numWrittenFunctions);
 }
 
-void StartBlock(ofstream &stream, unsigned int &numWrittenBlocks, bool definitions, bool metadata) {
+void StartBlock(CodeStream &stream, unsigned int &numWrittenBlocks, bool definitions, bool metadata) {
     if (!definitions && !metadata && numWrittenBlocks > 0)
         stream << endl;
 }
@@ -182,29 +188,31 @@ void EndBlock(unsigned int &numWrittenBlocks) {
     numWrittenBlocks++;
 }
 
-void WriteBlock(Function *fn, ofstream &stream, tabs t, Games::IDs game, unsigned int &numWrittenBlocks,
-    unsigned int &numWrittenFunctions, bool definitions, bool metadata, bool makeNewLine, Function::Flags flags = Function::Flags())
+void WriteBlock(Function *fn, CodeStream &stream, tabs t, Games::IDs game, unsigned int &numWrittenBlocks,
+    unsigned int &numWrittenFunctions, WrittenFunctions &written, bool definitions, bool metadata, bool makeNewLine,
+    Function::Flags flags = Function::Flags())
 {
-    if (fn && (flags.Empty() || !fn->mWrittenToSource)) {
+    if (fn && (flags.Empty() || !written.count(fn))) {
         StartBlock(stream, numWrittenBlocks, definitions, metadata);
-        WriteOneFunction(fn, stream, t, game, numWrittenFunctions, definitions, metadata, numWrittenBlocks == 0 && makeNewLine, flags);
+        WriteOneFunction(fn, stream, t, game, numWrittenFunctions, written, definitions, metadata, numWrittenBlocks == 0 && makeNewLine, flags);
         EndBlock(numWrittenBlocks);
     }
 }
 
-void WriteBlock(List<Function *> funcs, ofstream &stream, tabs t, Games::IDs game, unsigned int &numWrittenBlocks,
-    unsigned int &numWrittenFunctions, bool definitions, bool metadata, bool makeNewLine, Function::Flags flags = Function::Flags())
+void WriteBlock(List<Function *> const &funcs, CodeStream &stream, tabs t, Games::IDs game, unsigned int &numWrittenBlocks,
+    unsigned int &numWrittenFunctions, WrittenFunctions &written, bool definitions, bool metadata, bool makeNewLine,
+    Function::Flags flags = Function::Flags())
 {
     if (funcs.size() > 0) {
         unsigned int writtenCount = 0;
         bool first = true;
         for (auto fn : funcs) {
-            if (!fn->mWrittenToSource) {
+            if (!written.count(fn)) {
                 if (first) {
                     StartBlock(stream, numWrittenBlocks, definitions, metadata);
                     first = false;
                 }
-                WriteOneFunction(fn, stream, t, game, numWrittenFunctions, definitions, metadata, numWrittenBlocks == 0 && makeNewLine, flags);
+                WriteOneFunction(fn, stream, t, game, numWrittenFunctions, written, definitions, metadata, numWrittenBlocks == 0 && makeNewLine, flags);
                 writtenCount++;
             }
         }
@@ -213,36 +221,34 @@ void WriteBlock(List<Function *> funcs, ofstream &stream, tabs t, Games::IDs gam
     }
 }
 
-unsigned int Struct::WriteFunctions(ofstream &stream, tabs t, Games::IDs game, bool definitions, bool metadata, bool makeNewLine) {
-    for (auto &f : mFunctions)
-        f.mWrittenToSource = false;
+unsigned int Struct::WriteFunctions(CodeStream &stream, tabs t, Games::IDs game, bool definitions, bool metadata, bool makeNewLine) {
+    WrittenFunctions written;
     unsigned int numWrittenFunctions = 0;
     unsigned int numWrittenBlocks = 0;
     if (metadata) {
         StartBlock(stream, numWrittenBlocks, definitions, metadata);
         for (auto &f : mFunctions)
-            WriteOneFunction(&f, stream, t, game, numWrittenFunctions, definitions, metadata, makeNewLine);
+            WriteOneFunction(&f, stream, t, game, numWrittenFunctions, written, definitions, metadata, makeNewLine);
         EndBlock(numWrittenBlocks);
     }
     else {
         if (mConstruction == Construction::Default || definitions) {
-            WriteBlock(mDefaultConstructor, stream, t, game, numWrittenBlocks, numWrittenFunctions, definitions, metadata, makeNewLine);
-            WriteBlock(mCustomConstructors, stream, t, game, numWrittenBlocks, numWrittenFunctions, definitions, metadata, makeNewLine);
-            WriteBlock(mCopyConstructors, stream, t, game, numWrittenBlocks, numWrittenFunctions, definitions, metadata, makeNewLine);
-            WriteBlock(mBaseDestructor, stream, t, game, numWrittenBlocks, numWrittenFunctions, definitions, metadata, makeNewLine);
-            WriteBlock(mOperatorsNew, stream, t, game, numWrittenBlocks, numWrittenFunctions, definitions, metadata, makeNewLine);
-            WriteBlock(mOperatorsNewArray, stream, t, game, numWrittenBlocks, numWrittenFunctions, definitions, metadata, makeNewLine);
-            WriteBlock(mOperatorsDelete, stream, t, game, numWrittenBlocks, numWrittenFunctions, definitions, metadata, makeNewLine);
-            WriteBlock(mOperatorsDeleteArray, stream, t, game, numWrittenBlocks, numWrittenFunctions, definitions, metadata, makeNewLine);
+            WriteBlock(mDefaultConstructor, stream, t, game, numWrittenBlocks, numWrittenFunctions, written, definitions, metadata, makeNewLine);
+            WriteBlock(mCustomConstructors, stream, t, game, numWrittenBlocks, numWrittenFunctions, written, definitions, metadata, makeNewLine);
+            WriteBlock(mCopyConstructors, stream, t, game, numWrittenBlocks, numWrittenFunctions, written, definitions, metadata, makeNewLine);
+            WriteBlock(mBaseDestructor, stream, t, game, numWrittenBlocks, numWrittenFunctions, written, definitions, metadata, makeNewLine);
+            WriteBlock(mOperatorsNew, stream, t, game, numWrittenBlocks, numWrittenFunctions, written, definitions, metadata, makeNewLine);
+            WriteBlock(mOperatorsNewArray, stream, t, game, numWrittenBlocks, numWrittenFunctions, written, definitions, metadata, makeNewLine);
+            WriteBlock(mOperatorsDelete, stream, t, game, numWrittenBlocks, numWrittenFunctions, written, definitions, metadata, makeNewLine);
+            WriteBlock(mOperatorsDeleteArray, stream, t, game, numWrittenBlocks, numWrittenFunctions, written, definitions, metadata, makeNewLine);
         }
-        WriteBlock(mOperators, stream, t, game, numWrittenBlocks, numWrittenFunctions, definitions, metadata, makeNewLine);
+        WriteBlock(mOperators, stream, t, game, numWrittenBlocks, numWrittenFunctions, written, definitions, metadata, makeNewLine);
         // vtable
         unsigned int numWrittenVirtualFuncs = 0;
         IterateIndex(mVTable, [&](VTableMethod &vm, int index) {
             Function *funcToWrite = nullptr;
+            Function overridenFunc; // pure function, written with this class as its scope
             string funcReplacement;
-            Struct *oldClass = nullptr; string oldScope, oldFullClassName, oldShortClassName, oldRetTypeName;
-            bool resetCloneFunc = false;
 
             if (vm.mUnique || (!mParent || index >= static_cast<int>(mParent->mVTableSize))) {
                 if (vm.mFunc) {
@@ -251,19 +257,15 @@ unsigned int Struct::WriteFunctions(ofstream &stream, tabs t, Games::IDs game, b
                     else {
                         funcToWrite = vm.mFunc;
                         if (vm.mPureOverriden) {
-                            oldScope = funcToWrite->mScope;
-                            oldClass = funcToWrite->mClass;
-                            oldFullClassName = funcToWrite->mFullClassName;
-                            oldShortClassName = funcToWrite->mShortClassName;
+                            // function belongs to a derived class - a local copy is changed, not the shared model
+                            overridenFunc = *vm.mFunc;
+                            funcToWrite = &overridenFunc;
                             funcToWrite->mScope = GetFullName();
                             funcToWrite->mClass = this;
                             funcToWrite->mFullClassName = GetFullName();
                             funcToWrite->mShortClassName = mName;
-                            if (funcToWrite->mName == "Clone") {
-                                oldRetTypeName = funcToWrite->mRetType.mName;
+                            if (funcToWrite->mName == "Clone")
                                 funcToWrite->mRetType.mName = GetFullName();
-                                resetCloneFunc = true;
-                            }
                         }
                     }
                 }
@@ -280,7 +282,7 @@ unsigned int Struct::WriteFunctions(ofstream &stream, tabs t, Games::IDs game, b
                     Function::Flags flags;
                     if (vm.mPureOverriden)
                         flags.OverridenVirtualFunc = true;
-                    WriteOneFunction(funcToWrite, stream, t, game, numWrittenFunctions, definitions, metadata,
+                    WriteOneFunction(funcToWrite, stream, t, game, numWrittenFunctions, written, definitions, metadata,
                         numWrittenBlocks == 0 && makeNewLine, flags);
                 }
                 else {
@@ -292,31 +294,20 @@ unsigned int Struct::WriteFunctions(ofstream &stream, tabs t, Games::IDs game, b
                 }
                 numWrittenVirtualFuncs++;
             }
-
-            if (funcToWrite) {
-                if (vm.mPureOverriden) {
-                    funcToWrite->mScope = oldScope;
-                    funcToWrite->mClass = oldClass;
-                    funcToWrite->mFullClassName = oldFullClassName;
-                    funcToWrite->mShortClassName = oldShortClassName;
-                }
-                if (resetCloneFunc)
-                    funcToWrite->mRetType.mName = oldRetTypeName;
-            }
         });
         if (numWrittenVirtualFuncs > 0)
             EndBlock(numWrittenBlocks);
 
         for (auto sf : mNonStaticFunctions) {
             if (sf->mUsage != Function::Usage::Default)
-                sf->mWrittenToSource = true;
+                written.insert(sf);
         }
-        WriteBlock(mNonStaticFunctions, stream, t, game, numWrittenBlocks, numWrittenFunctions, definitions, metadata, makeNewLine);
+        WriteBlock(mNonStaticFunctions, stream, t, game, numWrittenBlocks, numWrittenFunctions, written, definitions, metadata, makeNewLine);
         for (auto sf : mStaticFunctions) {
             if (sf->mUsage != Function::Usage::Default)
-                sf->mWrittenToSource = true;
+                written.insert(sf);
         }
-        WriteBlock(mStaticFunctions, stream, t, game, numWrittenBlocks, numWrittenFunctions, definitions, metadata, makeNewLine);
+        WriteBlock(mStaticFunctions, stream, t, game, numWrittenBlocks, numWrittenFunctions, written, definitions, metadata, makeNewLine);
 
         // Write WS functions
         List<Function *> wsFunctions;
@@ -326,12 +317,12 @@ unsigned int Struct::WriteFunctions(ofstream &stream, tabs t, Games::IDs game, b
         }
         Function::Flags flags;
         flags.OverloadedWideStringFunc = true;
-        WriteBlock(wsFunctions, stream, t, game, numWrittenBlocks, numWrittenFunctions, definitions, metadata, makeNewLine, flags);
+        WriteBlock(wsFunctions, stream, t, game, numWrittenBlocks, numWrittenFunctions, written, definitions, metadata, makeNewLine, flags);
     }
     return numWrittenFunctions;
 }
 
-void Struct::WriteStackObjectFunction(ofstream & stream, tabs t, Games::IDs game, Function *fn) {
+void Struct::WriteStackObjectFunction(CodeStream & stream, tabs t, Games::IDs game, Function *fn) {
     stream << t();
     string fnName;
     if (fn->IsDestructor())
@@ -366,7 +357,7 @@ void AddOperatorNewToUniqueList(List<Function *> &uniqueList, Function *fn) {
     uniqueList.push_back(fn);
 }
 
-void Struct::WriteCustomOperatorNewFunction(ofstream & stream, tabs t, Games::IDs game, Function *ctor, bool writeArrayNew) {
+void Struct::WriteCustomOperatorNewFunction(CodeStream & stream, tabs t, Games::IDs game, Function *ctor, bool writeArrayNew) {
     for (int i = 0; i < (writeArrayNew + 1); i++) {
         bool isArray = i == 1;
         List<Function *> opNewList;
@@ -478,7 +469,7 @@ void Struct::WriteCustomOperatorNewFunction(ofstream & stream, tabs t, Games::ID
     }
 }
 
-void Struct::WriteCustomOperatorDeleteFunction(ofstream & stream, tabs t, Games::IDs game) {
+void Struct::WriteCustomOperatorDeleteFunction(CodeStream & stream, tabs t, Games::IDs game) {
     Function *dtor = mDeletingDestructor;
     if (!dtor)
         dtor = mBaseDestructor;
@@ -514,7 +505,7 @@ void Struct::WriteCustomOperatorDeleteFunction(ofstream & stream, tabs t, Games:
     stream << t() << "}" << endl;
 }
 
-void Struct::WriteCustomOperatorDeleteArrayFunction(ofstream & stream, tabs t, Games::IDs game) {
+void Struct::WriteCustomOperatorDeleteArrayFunction(CodeStream & stream, tabs t, Games::IDs game) {
     Function *dtor = mDeletingDestructor;
     if (!dtor)
         dtor = mBaseDestructor;
@@ -557,7 +548,7 @@ void Struct::WriteCustomOperatorDeleteArrayFunction(ofstream & stream, tabs t, G
     stream << t() << "}" << endl;
 }
 
-void Struct::WriteGeneratedConstruction(ofstream & stream, tabs t, Games::IDs game) {
+void Struct::WriteGeneratedConstruction(CodeStream & stream, tabs t, Games::IDs game) {
     if (!UsesCustomConstruction() || mIsAbstractClass)
         return;
     bool hasStackObject = false;
@@ -595,7 +586,7 @@ void Struct::WriteGeneratedConstruction(ofstream & stream, tabs t, Games::IDs ga
     }
 }
 
-void Struct::OnUpdateStructs(List<Module> &modules) {
+void Struct::OnUpdateStructs(TypeGraph const &graph) {
     auto SortByParameterCount = [](Function *f1, Function *f2) { return f1->mParameters.size() < f2->mParameters.size(); };
     auto SortByName = [](Function *f1, Function *f2) { return f1->mName < f2->mName; };
     auto SortByVTableIndex = [](Function *f1, Function *f2) { return f1->mVTableIndex < f2->mVTableIndex; };
@@ -621,33 +612,26 @@ void Struct::OnUpdateStructs(List<Module> &modules) {
     if (mStaticFunctions.size() > 0)
         mStaticFunctions.sort(SortByName);
 
-    for (auto &m : mMembers) {
-        if (!m.mIsVTable && m.mType.mIsCustom && m.mType.mPointers.size() == 0 && !m.mType.mIsFunction && !m.mType.mIsTemplate) {
-            Struct *ms = nullptr;
-            for (auto &mdl : modules) {
-                ms = mdl.FindStruct(m.mType.mName, true);
-                if (ms)
-                    break;
-            }
-            if (ms && ms != this)
-                mMemberClasses.insert(ms);
-        }
+    auto node = graph.GetNode(this);
+    if (node) {
+        for (auto ms : node->mMemberClasses)
+            mMemberClasses.insert(graph.mNodes[ms].mStruct);
     }
 
     CreateVTable();
 }
 
-bool TypePresentCB(Type &t, string const &typeName) {
+bool TypePresentCB(Type const &t, string const &typeName) {
     if (t.mIsCustom && !t.mIsRenderWare && t.mName == typeName)
         return true;
     if (t.IsTemplate()) {
-        for (Type &tt : t.mTemplateTypes) {
+        for (Type const &tt : t.mTemplateTypes) {
             if (TypePresentCB(tt, typeName))
                 return true;
         }
     }
     if (t.mIsFunction) {
-        for (Type &fp : t.mFunctionParams) {
+        for (Type const &fp : t.mFunctionParams) {
             if (TypePresentCB(fp, typeName))
                 return true;
         }
@@ -667,7 +651,7 @@ bool Struct::ContainsType(string const &typeName, bool withPointers) {
     return false;
 }
 
-string Struct::GetFullName() {
+string Struct::GetFullName() const {
     if (mScope.empty())
         return mName;
     return mScope + "::" + mName;
@@ -779,7 +763,7 @@ bool Struct::UsesCustomConstruction() {
     return false;
 }
 
-void Struct::WriteStructExtraInfo(ofstream & stream) {
+void Struct::WriteStructExtraInfo(CodeStream & stream) {
     if (mHasVTable)
         stream << "VTABLE_DESC(" << GetFullName() << ", " << String::ToHexString(mVTableAddress) << ", " << mVTableSize << ");" << endl;
     if (mSize > 0)
@@ -789,6 +773,7 @@ void Struct::WriteStructExtraInfo(ofstream & stream) {
 void Struct::CreateVTable() {
     if (mCreatedOrCheckedVTable)
         return;
+    Trace::Scope traceScope("update", "CreateVTable", mName);
     if (mParent)
         mParent->CreateVTable();
     if (mVTableSize > 0) {
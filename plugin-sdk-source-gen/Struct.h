@@ -3,6 +3,7 @@
 #include "ListEx.h"
 #include <fstream>
 #include "Tabs.h"
+#include "CodeStream.h"
 #include "Type.h"
 #include "Function.h"
 #include "Variable.h"
@@ -11,6 +12,7 @@
 using namespace std;
 
 class Module;
+class TypeGraph;
 
 class StructMember {
 public:
@@ -23,6 +25,7 @@ public:
     bool mIsPadding = false;  // if member has "_pad" in its name
     bool mIsVTable = false;   // is vtable pointer
     bool mIsAnonymous = false; // is anonymous member (has no name)
+    bool mIsBitfield = false; // marked as bitfield in database (mBitfield is linked when struct is added to module)
     Enum *mBitfield = nullptr; // associated bitfield
 };
 
@@ -70,6 +73,7 @@ public:
     List<Struct *> mNestedClasses; // nested classes
 
     Set<Struct *> mMemberClasses;
+    int mGraphIndex = -1;         // node index in TypeGraph
 
     List<StructMember> mMembers;  // class fields
     List<Variable> mVariables;    // variables
@@ -96,20 +100,20 @@ public:
 
     Vector<VTableMethod> mVTable;
 
-    void OnUpdateStructs(List<Module> &modules); // update things before we write to source files
-    string GetFullName();         // combine name + scope
-    void Write(ofstream &stream, tabs t, Module &myModule, List<Module> const &allModules, Games::IDs game);
-    unsigned int WriteFunctions(ofstream &stream, tabs t, Games::IDs game, bool definitions, bool metadata, bool makeNewLine);
-    void WriteGeneratedConstruction(ofstream &stream, tabs t, Games::IDs game);
-    void WriteStackObjectFunction(ofstream & stream, tabs t, Games::IDs game, Function *fn);
-    void WriteCustomOperatorNewFunction(ofstream & stream, tabs t, Games::IDs game, Function *ctor, bool writeArrayNew);
-    void WriteCustomOperatorDeleteFunction(ofstream & stream, tabs t, Games::IDs game);
-    void WriteCustomOperatorDeleteArrayFunction(ofstream & stream, tabs t, Games::IDs game);
+    void OnUpdateStructs(TypeGraph const &graph); // update things before we write to source files
+    string GetFullName() const;   // combine name + scope
+    void Write(CodeStream &stream, tabs t, Module &myModule, List<Module> const &allModules, Games::IDs game);
+    unsigned int WriteFunctions(CodeStream &stream, tabs t, Games::IDs game, bool definitions, bool metadata, bool makeNewLine);
+    void WriteGeneratedConstruction(CodeStream &stream, tabs t, Games::IDs game);
+    void WriteStackObjectFunction(CodeStream & stream, tabs t, Games::IDs game, Function *fn);
+    void WriteCustomOperatorNewFunction(CodeStream & stream, tabs t, Games::IDs game, Function *ctor, bool writeArrayNew);
+    void WriteCustomOperatorDeleteFunction(CodeStream & stream, tabs t, Games::IDs game);
+    void WriteCustomOperatorDeleteArrayFunction(CodeStream & stream, tabs t, Games::IDs game);
     bool ContainsType(string const &typeName, bool withPointers = true);
     void AddFunction(Function &func_to_add);
     void SetParent(Struct *parent);
     void SetEnclose(Struct *enclose);
     bool UsesCustomConstruction();
-    void WriteStructExtraInfo(ofstream &stream);
+    void WriteStructExtraInfo(CodeStream &stream);
     void CreateVTable();
 };
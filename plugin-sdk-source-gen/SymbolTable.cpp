@@ -0,0 +1,48 @@
+#include "SymbolTable.h"
+#include "Module.h"
+
+Module *SymbolTable::FindModule(string const &name) {
+    auto it = mModules.find(name);
+    Module *result = it != mModules.end() ? it->second : nullptr;
+    CountLookup(result != nullptr);
+    return result;
+}
+
+void SymbolTable::AddModule(Module *m) {
+    m->mIndex = mModules.size();
+    m->mSymbols = this;
+    mModules.emplace(m->mName, m);
+    mModulesByIndex.push_back(m);
+}
+
+Struct *SymbolTable::FindStruct(string const &fullName) {
+    auto it = mStructs.find(fullName);
+    Struct *result = it != mStructs.end() ? it->second : nullptr;
+    CountLookup(result != nullptr);
+    return result;
+}
+
+void SymbolTable::AddStruct(Struct *s) {
+    // keep the same result as linear search over all modules: the first module in list
+    // order (and the first struct inside this module) wins
+    auto result = mStructs.emplace(s->GetFullName(), s);
+    if (!result.second && result.first->second->mModule->mIndex > s->mModule->mIndex)
+        result.first->second = s;
+}
+
+void SymbolTable::Clear() {
+    mModules.clear();
+    mModulesByIndex.clear();
+    mStructs.clear();
+}
+
+void SymbolTable::CountLookup(bool found) {
+    mNumLookups.fetch_add(1, memory_order_relaxed);
+    if (found)
+        mNumHits.fetch_add(1, memory_order_relaxed);
+}
+
+void SymbolTable::WriteStats(ostream &stream) {
+    stream << "Symbol table: " << mModules.size() << " modules, " << mStructs.size() << " structs, "
+        << mNumLookups.load() << " lookups (" << mNumHits.load() << " found)" << endl;
+}
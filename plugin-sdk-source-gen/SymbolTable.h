@@ -0,0 +1,31 @@
+#pragma once
+#include <string>
+#include <atomic>
+#include <ostream>
+#include <unordered_map>
+#include "ListEx.h"
+
+using namespace std;
+
+class Module;
+class Struct;
+
+// Name lookup tables for one generator run (one game).
+// Modules register themselves here when created, structs are added by Module::AddEmptyStruct.
+class SymbolTable {
+    unordered_map<string, Module *> mModules;
+    Vector<Module *> mModulesByIndex;
+    unordered_map<string, Struct *> mStructs; // by full name, struct from the first module wins
+public:
+    atomic<unsigned long long> mNumLookups{ 0 };
+    atomic<unsigned long long> mNumHits{ 0 };
+
+    Module *FindModule(string const &name);
+    void AddModule(Module *m);
+    Module *GetModule(unsigned int index) { return mModulesByIndex[index]; } // by Module::mIndex
+    Struct *FindStruct(string const &fullName); // search struct in all modules
+    void AddStruct(Struct *s);
+    void Clear();
+    void CountLookup(bool found);
+    void WriteStats(ostream &stream);
+};
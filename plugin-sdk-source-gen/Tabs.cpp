@@ -1,4 +1,5 @@
 #include "Tabs.h"
+#include <algorithm>
 
 tabs::tabs() {
     mCount = 0;
@@ -8,10 +9,9 @@ tabs::tabs(unsigned int count) {
     mCount = count;
 }
 
-string tabs::operator()() {
-    if (mCount > 0)
-        return string(mCount * 4, ' ');
-    return "";
+string_view tabs::operator()() {
+    static const string spaces(1024, ' '); // precomputed indentation (256 levels)
+    return string_view(spaces.data(), min<size_t>(mCount * 4, spaces.size()));
 }
 
 void tabs::operator+=(unsigned int const &count) {
@@ -1,5 +1,6 @@
 #pragma once
 #include <string>
+#include <string_view>
 
 using namespace std;
 
@@ -8,7 +9,7 @@ class tabs {
 public:
     tabs();
     tabs(unsigned int count);
-    string operator()();
+    string_view operator()(); // indentation string
     void operator+=(unsigned int const &count);
     void operator-=(unsigned int const &count);
     tabs &operator++();
@@ -0,0 +1,85 @@
+#include "Trace.h"
+#include "OutputFile.h"
+#include "..\shared\json\json.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <iomanip>
+
+using json = nlohmann::json;
+
+bool Trace::mEnabled = false;
+chrono::steady_clock::time_point Trace::mStartTime;
+vector<Trace::Event> Trace::mEvents;
+mutex Trace::mMutex;
+
+void Trace::Enable() {
+    mStartTime = chrono::steady_clock::now();
+    mEnabled = true;
+}
+
+long long Trace::GetTime() {
+    return chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - mStartTime).count();
+}
+
+unsigned int Trace::GetThreadIndex() {
+    static atomic<unsigned int> numThreads{ 0 };
+    static thread_local unsigned int index = numThreads++;
+    return index;
+}
+
+bool Trace::Write(path const &filepath) {
+    json events = json::array();
+    lock_guard<mutex> lock(mMutex);
+    for (auto const &e : mEvents) {
+        json je;
+        je["name"] = e.mName;
+        je["cat"] = e.mCategory;
+        je["ph"] = "X";
+        je["ts"] = e.mStart;
+        je["dur"] = e.mDuration;
+        je["pid"] = 1;
+        je["tid"] = e.mThread;
+        events.push_back(je);
+    }
+    json j;
+    j["traceEvents"] = events;
+    j["displayTimeUnit"] = "ms";
+    return OutputFile::Write(filepath, j.dump() + '\n') != OutputFile::Result::Error;
+}
+
+void Trace::WriteSlowest(ostream &stream, char const *category, unsigned int count) {
+    vector<Event const *> events;
+    lock_guard<mutex> lock(mMutex);
+    for (auto const &e : mEvents) {
+        if (!strcmp(e.mCategory, category))
+            events.push_back(&e);
+    }
+    count = min<unsigned int>(count, events.size());
+    partial_sort(events.begin(), events.begin() + count, events.end(),
+        [](Event const *a, Event const *b) { return a->mDuration > b->mDuration; });
+    auto flags = stream.flags();
+    auto precision = stream.precision();
+    stream << "Slowest " << category << " events:" << endl;
+    for (unsigned int i = 0; i < count; i++)
+        stream << "    " << fixed << setprecision(3) << (events[i]->mDuration / 1000.0) << " ms  " << events[i]->mName << endl;
+    stream.flags(flags);
+    stream.precision(precision);
+}
+
+Trace::Scope::Scope(char const *category, string const &name, string const &detail) {
+    if (!mEnabled)
+        return;
+    mCategory = category;
+    mName = detail.empty() ? name : name + " (" + detail + ")";
+    mStart = GetTime();
+}
+
+void Trace::Scope::Stop() {
+    if (!mCategory)
+        return;
+    long long end = GetTime();
+    lock_guard<mutex> lock(mMutex);
+    mEvents.push_back({ move(mName), mCategory, mStart, end - mStart, GetThreadIndex() });
+    mCategory = nullptr;
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <mutex>
+#include <chrono>
+#include <ostream>
+#include <filesystem>
+
+using namespace std;
+using namespace std::experimental::filesystem;
+
+// Scoped timers for --trace. Events are written in Chrome trace-event format (chrome://tracing).
+// When tracing is disabled, Trace::Scope only checks a flag.
+class Trace {
+    struct Event {
+        string mName;
+        char const *mCategory;
+        long long mStart; // microseconds from Enable()
+        long long mDuration;
+        unsigned int mThread;
+    };
+
+    static bool mEnabled;
+    static chrono::steady_clock::time_point mStartTime;
+    static vector<Event> mEvents;
+    static mutex mMutex;
+
+    static long long GetTime();
+    static unsigned int GetThreadIndex();
+public:
+    static void Enable();
+    static bool IsEnabled() { return mEnabled; }
+    static bool Write(path const &filepath);
+    static void WriteSlowest(ostream &stream, char const *category, unsigned int count); // top 'count' events of the category
+
+    // records the time from construction to destruction; name is "name (detail)"
+    class Scope {
+        char const *mCategory = nullptr; // nullptr - tracing is disabled
+        string mName;
+        long long mStart = 0;
+    public:
+        Scope(char const *category, string const &name, string const &detail = string());
+        ~Scope() { Stop(); }
+        void Stop(); // record the event before the end of the scope
+    };
+};
@@ -4,38 +4,15 @@
 #include <algorithm>
 #include <iostream>
 #include <iomanip>
+#include <unordered_map>
+#include <shared_mutex>
+#include <mutex>
+#include <atomic>
 
-Type::Type(Type const &rhs) {
-    mName = rhs.mName;
-    mIsNumber = rhs.mIsNumber;
-    mIsEllipsis = rhs.mIsEllipsis;
-    mIsVoid = rhs.mIsVoid;
-    mIsPointerToFixedSizeArray = rhs.mIsPointerToFixedSizeArray;
-    mArraySize[0] = rhs.mArraySize[0];
-    mArraySize[1] = rhs.mArraySize[1];
-    mIsConst = rhs.mIsConst;
-    mIsInBuilt = rhs.mIsInBuilt;
-    mIsCustom = rhs.mIsCustom;
-    mIsRenderWare = rhs.mIsRenderWare;
-    mPointers = rhs.mPointers;
-    mFunctionOrArrayPointers = rhs.mFunctionOrArrayPointers;
-    mIsFunction = rhs.mIsFunction;
-    mFunctionCC = rhs.mFunctionCC;
-    mFunctionParams = rhs.mFunctionParams;
-    if (rhs.mFunctionRetType)
-        mFunctionRetType = new Type(*rhs.mFunctionRetType);
-    else
-        mFunctionRetType = nullptr;
-    mIsTemplate = rhs.mIsTemplate;
-    mTemplateTypes = rhs.mTemplateTypes;
-    mIsForwardDecl = rhs.mIsForwardDecl;
-    mWasSetFromRawType = rhs.mWasSetFromRawType;
-    mDbgTokens = rhs.mDbgTokens;
-}
-
-Type::~Type() {
-    delete mFunctionRetType;
-}
+// parse cache: type string -> parsed type; types are parsed from worker threads
+unordered_map<string, shared_ptr<Type const>> gTypeCache;
+shared_mutex gTypeCacheMutex;
+atomic<unsigned long long> gNumTypeLookups{ 0 };
 
 bool IsSpecialCharacter(char c) {
     return c == '*' || c == '&' || c == '<' || c == '>' || c == ',' || c == '(' || c == ')' || c == '[' || c == ']';
@@ -299,28 +276,26 @@ Vector<Token> GetTokens(string const &line) {
     return result;
 }
 
-string Type::GetFullType(bool leaveSpaceAtTheEnd) {
+string Type::GetFullType(bool leaveSpaceAtTheEnd) const {
     return BeforeName(leaveSpaceAtTheEnd) + AfterName();
 }
 
-string Type::GetFullTypeRemovePointer() {
-    string savedPtrs = mPointers;
-    if (mPointers.size() > 0)
-        mPointers.pop_back();
-    string result = GetFullType();
-    mPointers = savedPtrs;
-    return result;
+string Type::GetFullTypeRemovePointer() const {
+    Type type = *this;
+    if (type.mPointers.size() > 0)
+        type.mPointers.pop_back();
+    return type.GetFullType();
 }
 
-bool Type::IsPointer() {
+bool Type::IsPointer() const {
     return mPointers.size() > 0 || mIsPointerToFixedSizeArray;
 }
 
-bool Type::IsTemplate() {
+bool Type::IsTemplate() const {
     return mTemplateTypes.size() > 0;
 }
 
-string Type::BeforeName(bool leaveSpaceAtTheEnd) {
+string Type::BeforeName(bool leaveSpaceAtTheEnd) const {
     string result;
     if (mIsFunction) {
         if (mFunctionRetType)
@@ -333,11 +308,11 @@ string Type::BeforeName(bool leaveSpaceAtTheEnd) {
         result = mName;
         if (IsTemplate()) {
             result += '<';
-            IterateFirstLast(mTemplateTypes, [&](Type &type, bool first, bool last) {
-                if (!first)
+            for (size_t i = 0; i < mTemplateTypes.size(); i++) {
+                if (i != 0)
                     result += ", ";
-                result += type.GetFullType(false);
-            });
+                result += mTemplateTypes[i].GetFullType(false);
+            }
             result += '>';
         }
         if (mIsConst)
@@ -365,7 +340,7 @@ string Type::BeforeName(bool leaveSpaceAtTheEnd) {
     return result;
 }
 
-string Type::AfterName() {
+string Type::AfterName() const {
     string result;
     if (!mFunctionOrArrayPointers.empty())
         result += ')';
@@ -376,11 +351,11 @@ string Type::AfterName() {
     }
     if (mIsFunction) {
         result += ")(";
-        IterateFirstLast(mFunctionParams, [&](Type &type, bool first, bool last) {
-            if (!first)
+        for (size_t i = 0; i < mFunctionParams.size(); i++) {
+            if (i != 0)
                 result += ", ";
-            result += type.GetFullType();
-        });
+            result += mFunctionParams[i].GetFullType();
+        }
         result += ')';
     }
     return result;
@@ -427,34 +402,62 @@ void Type::SetFunctionTypeFromToken(Token const &t) {
 }
 
 void Type::AddRetTypeForFunction() {
-    delete mFunctionRetType;
-    mFunctionRetType = new Type;
-    mFunctionRetType->mName = mName;
+    auto retType = make_shared<Type>();
+    retType->mName = mName;
     mName = "Function";
-    mFunctionRetType->mPointers = mPointers;
+    retType->mPointers = mPointers;
     mPointers.clear();
     mFunctionOrArrayPointers.clear();
-    mFunctionRetType->mIsConst = mIsConst;
+    retType->mIsConst = mIsConst;
     mIsConst = false;
-    mFunctionRetType->mIsInBuilt = mIsInBuilt;
+    retType->mIsInBuilt = mIsInBuilt;
     mIsInBuilt = false;
-    mFunctionRetType->mIsEllipsis = mIsEllipsis;
+    retType->mIsEllipsis = mIsEllipsis;
     mIsEllipsis = false;
-    mFunctionRetType->mIsRenderWare = mIsRenderWare;
+    retType->mIsRenderWare = mIsRenderWare;
     mIsRenderWare = false;
-    mFunctionRetType->mIsVoid = mIsVoid;
+    retType->mIsVoid = mIsVoid;
     mIsVoid = false;
-    mFunctionRetType->mIsTemplate = mIsTemplate;
+    retType->mIsTemplate = mIsTemplate;
     mIsTemplate = false;
-    mFunctionRetType->mTemplateTypes = mTemplateTypes;
-    mTemplateTypes.clear();
+    retType->mTemplateTypes = mTemplateTypes;
+    mTemplateTypes = SharedVector<Type>();
     mArraySize[0] = 0;
     mArraySize[1] = 0;
+    mFunctionRetType = retType;
 }
 
 void Type::SetFromString(string const &str) {
-    auto tokens = GetTokens(str);
-    SetFromTokens(tokens);
+    // note: mWasSetFromRawType is set by the caller and is not a part of cached type
+    bool wasSetFromRawType = mWasSetFromRawType;
+    gNumTypeLookups++;
+    {
+        shared_lock<shared_mutex> lock(gTypeCacheMutex);
+        auto it = gTypeCache.find(str);
+        if (it != gTypeCache.end()) {
+            *this = *it->second;
+            mWasSetFromRawType = wasSetFromRawType;
+            return;
+        }
+    }
+    auto parsed = make_shared<Type>();
+    parsed->SetFromTokens(GetTokens(str));
+    {
+        unique_lock<shared_mutex> lock(gTypeCacheMutex);
+        gTypeCache.emplace(str, parsed);
+    }
+    *this = *parsed;
+    mWasSetFromRawType = wasSetFromRawType;
+}
+
+void Type::WriteCacheStats(ostream &stream) {
+    shared_lock<shared_mutex> lock(gTypeCacheMutex);
+    stream << "Type cache: " << gNumTypeLookups.load() << " types parsed, " << gTypeCache.size() << " unique" << endl;
+}
+
+void Type::ClearCache() {
+    unique_lock<shared_mutex> lock(gTypeCacheMutex);
+    gTypeCache.clear();
 }
 
 void Type::SetFromTokens(Vector<Token> const &tokens) {
@@ -504,9 +507,10 @@ void Type::SetFromTokens(Vector<Token> const &tokens) {
                     else if (t.value[0] == '<') {
                         auto vttypes = SplitTypes(tokens, i);
                         mIsTemplate = true;
-                        mTemplateTypes.resize(vttypes.size());
-                        for (size_t vt = 0; vt < mTemplateTypes.size(); vt++)
-                            mTemplateTypes[vt].SetFromTokens(vttypes[vt]);
+                        Vector<Type> templateTypes(vttypes.size());
+                        for (size_t vt = 0; vt < templateTypes.size(); vt++)
+                            templateTypes[vt].SetFromTokens(vttypes[vt]);
+                        mTemplateTypes = move(templateTypes);
                     }
                     else if (t.value[0] == '(') {
                         if (!mIsFunction && right >= 3 &&
@@ -534,9 +538,10 @@ void Type::SetFromTokens(Vector<Token> const &tokens) {
                             }
                             if (scanParameters) {
                                 auto vfptypes = SplitTypes(tokens, i);
-                                mFunctionParams.resize(vfptypes.size());
-                                for (size_t vt = 0; vt < mFunctionParams.size(); vt++)
-                                    mFunctionParams[vt].SetFromTokens(vfptypes[vt]);
+                                Vector<Type> functionParams(vfptypes.size());
+                                for (size_t vt = 0; vt < functionParams.size(); vt++)
+                                    functionParams[vt].SetFromTokens(vfptypes[vt]);
+                                mFunctionParams = move(functionParams);
                             }
                         }
                     }
@@ -570,7 +575,7 @@ void Type::SetFromTokens(Vector<Token> const &tokens) {
         }
     }
 
-    mDbgTokens = tokens;
+    mDbgTokens = Vector<Token>(tokens);
 }
 
 void AddPointer(string &str, char ptrChar) {
@@ -579,7 +584,7 @@ void AddPointer(string &str, char ptrChar) {
     str += ptrChar;
 }
 
-Type Type::GetReference(char ref) {
+Type Type::GetReference(char ref) const {
     Type newType = *this;
     if (newType.mIsFunction) {
         if (newType.mArraySize[0] > 0)
@@ -604,7 +609,7 @@ string StrOffset(size_t offset) {
     return string(offset * 4, ' ');
 }
 
-void Type::DbgPrint(size_t offset) {
+void Type::DbgPrint(size_t offset) const {
     if (mIsNumber) {
         cout << StrOffset(offset) << "Number '" << mName << "'" << endl;
     }
@@ -636,7 +641,7 @@ void Type::DbgPrint(size_t offset) {
         cout << StrOffset(offset + 1) << "}" << endl;
 
         cout << StrOffset(offset + 1) << "functionparams {" << endl;
-        for (Type &fp : mFunctionParams)
+        for (Type const &fp : mFunctionParams)
             fp.DbgPrint(offset + 2);
         cout << StrOffset(offset + 1) << "}" << endl;
         cout << StrOffset(offset) << "}" << endl;
@@ -663,7 +668,7 @@ void Type::DbgPrint(size_t offset) {
         cout << endl;
         if (mIsTemplate) {
             cout << StrOffset(offset + 1) << "templateparams {" << endl;
-            for (Type &tt : mTemplateTypes)
+            for (Type const &tt : mTemplateTypes)
                 tt.DbgPrint(offset + 2);
             cout << StrOffset(offset + 1) << "}" << endl;
         }
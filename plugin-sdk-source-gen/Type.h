@@ -1,5 +1,7 @@
 #pragma once
 #include <string>
+#include <memory>
+#include <ostream>
 #include "ListEx.h"
 
 using namespace std;
@@ -69,38 +71,40 @@ public:
     // function
     bool mIsFunction = false;
     FunctionCC mFunctionCC = CC_CDECL;
-    Vector<Type> mFunctionParams;
-    Type *mFunctionRetType = nullptr;
+    SharedVector<Type> mFunctionParams;
+    shared_ptr<Type const> mFunctionRetType;
 
     // template
     bool mIsTemplate = false;
-    Vector<Type> mTemplateTypes;
+    SharedVector<Type> mTemplateTypes;
 
     bool mWasSetFromRawType = false; // this type was set from 'rawtype' or 'rt_...' attribute
     bool mIsForwardDecl = false; // this type used 'struct' or 'class' in declaration
 
     // debug
-    Vector<Token> mDbgTokens;
+    SharedVector<Token> mDbgTokens;
 
-    Type() = default;
-    Type(Type const &rhs);
-    ~Type();
+    // nested types (function parameters, return type, template types) and tokens are
+    // immutable and shared between copies, so copying a type is cheap
     
-    void SetFromString(string const &str);
+    void SetFromString(string const &str); // parsed types are cached by string
     void SetFromTokens(Vector<Token> const &tokens);
-    string GetFullType(bool leaveSpaceAtTheEnd = true);
-    string GetFullTypeRemovePointer();
-    string BeforeName(bool leaveSpaceAtTheEnd = true);
-    string AfterName();
+    string GetFullType(bool leaveSpaceAtTheEnd = true) const;
+    string GetFullTypeRemovePointer() const;
+    string BeforeName(bool leaveSpaceAtTheEnd = true) const;
+    string AfterName() const;
 
-    bool IsPointer();
-    bool IsTemplate();
+    bool IsPointer() const;
+    bool IsTemplate() const;
 
     void SetFunctionTypeFromToken(Token const &t);
 
     void AddRetTypeForFunction();
 
-    void DbgPrint(size_t offset = 0);
+    void DbgPrint(size_t offset = 0) const;
 
-    Type GetReference(char ref = '&');
+    static void WriteCacheStats(ostream &stream);
+    static void ClearCache(); // the cache only grows; cleared between generations in watch mode
+
+    Type GetReference(char ref = '&') const;
 };
@@ -0,0 +1,158 @@
+#include "TypeGraph.h"
+#include "Module.h"
+#include "SymbolTable.h"
+#include "CodeStream.h"
+#include "OutputFile.h"
+#include "..\shared\json\json.hpp"
+#include <algorithm>
+
+using json = nlohmann::json;
+
+void TypeGraph::Build(List<Module> &modules, SymbolTable &symbols) {
+    mNodes.clear();
+    for (Module &m : modules) {
+        for (Struct &s : m.mStructs) {
+            s.mGraphIndex = mNodes.size();
+            mNodes.emplace_back().mStruct = &s;
+        }
+    }
+    for (unsigned int i = 0; i < mNodes.size(); i++) {
+        Node &node = mNodes[i];
+        Struct *s = node.mStruct;
+        if (!s->mParentName.empty()) {
+            Struct *parent = symbols.FindStruct(s->mParentName);
+            if (parent) {
+                node.mParent = parent->mGraphIndex;
+                mNodes[parent->mGraphIndex].mChildren.push_back(i);
+            }
+        }
+        if (s->mEncloseClass)
+            node.mEnclose = s->mEncloseClass->mGraphIndex;
+        for (auto nested : s->mNestedClasses)
+            node.mNested.push_back(nested->mGraphIndex);
+        for (auto &m : s->mMembers) {
+            if (!m.mIsVTable && m.mType.mIsCustom && m.mType.mPointers.size() == 0 && !m.mType.mIsFunction && !m.mType.mIsTemplate) {
+                Struct *ms = symbols.FindStruct(m.mType.mName);
+                if (ms && ms != s) {
+                    unsigned int msIndex = ms->mGraphIndex;
+                    if (find(node.mMemberClasses.begin(), node.mMemberClasses.end(), msIndex) == node.mMemberClasses.end())
+                        node.mMemberClasses.push_back(msIndex);
+                }
+            }
+        }
+    }
+    // number inheritance trees in depth-first order; children are visited in list order
+    mPreOrder.clear();
+    Vector<pair<unsigned int, unsigned int>> nodesToVisit; // node, next child
+    for (unsigned int i = 0; i < mNodes.size(); i++) {
+        if (mNodes[i].mParent != -1)
+            continue;
+        mNodes[i].mFirst = mPreOrder.size();
+        mPreOrder.push_back(i);
+        nodesToVisit.emplace_back(i, 0);
+        while (!nodesToVisit.empty()) {
+            auto &top = nodesToVisit.back();
+            Node &node = mNodes[top.first];
+            if (top.second < node.mChildren.size()) {
+                unsigned int c = node.mChildren[top.second++];
+                mNodes[c].mFirst = mPreOrder.size();
+                mPreOrder.push_back(c);
+                nodesToVisit.emplace_back(c, 0);
+            }
+            else {
+                node.mLast = mPreOrder.size();
+                nodesToVisit.pop_back();
+            }
+        }
+    }
+}
+
+TypeGraph::Node const *TypeGraph::GetNode(Struct const *s) const {
+    if (!s || s->mGraphIndex < 0 || static_cast<size_t>(s->mGraphIndex) >= mNodes.size() || mNodes[s->mGraphIndex].mStruct != s)
+        return nullptr;
+    return &mNodes[s->mGraphIndex];
+}
+
+void TypeGraph::CollectDescendantModules(Struct const *s, ModuleSet &modules) const {
+    Node const *node = GetNode(s);
+    if (node) {
+        for (unsigned int i = node->mFirst + 1; i < node->mLast; i++)
+            modules.Insert(mNodes[mPreOrder[i]].mStruct->mModule->mIndex);
+    }
+}
+
+void TypeGraph::WriteStats(ostream &stream) const {
+    unsigned int numInheritanceEdges = 0, numMemberEdges = 0, numNestedEdges = 0;
+    int largestRoot = -1;
+    unsigned int largestSize = 0;
+    for (unsigned int i = 0; i < mNodes.size(); i++) {
+        Node const &node = mNodes[i];
+        numInheritanceEdges += node.mChildren.size();
+        numNestedEdges += node.mNested.size();
+        numMemberEdges += node.mMemberClasses.size();
+        if (node.mParent == -1) {
+            unsigned int size = node.GetNumDescendants();
+            if (size > largestSize) {
+                largestSize = size;
+                largestRoot = i;
+            }
+        }
+    }
+    stream << "Type graph: " << mNodes.size() << " structs, " << numInheritanceEdges << " inheritance edges, "
+        << numNestedEdges << " nested edges, " << numMemberEdges << " member edges";
+    if (largestRoot != -1)
+        stream << ", largest hierarchy: " << mNodes[largestRoot].mStruct->GetFullName() << " (" << largestSize << " derived)";
+    stream << endl;
+}
+
+bool TypeGraph::WriteDot(path const &filepath, Games::IDs game) const {
+    CodeStream stream;
+    stream << "digraph \"" << Games::GetGameFolder(game) << "\" {" << endl;
+    stream << "    rankdir=BT;" << endl;
+    stream << "    node [shape=box];" << endl;
+    for (unsigned int i = 0; i < mNodes.size(); i++) {
+        Struct const *s = mNodes[i].mStruct;
+        stream << "    n" << i << " [label=\"" << s->GetFullName() << "\\n" << s->mModule->mName << "\"];" << endl;
+    }
+    // child -> parent: inheritance, nested -> enclose: dashed, struct -> member class: dotted
+    for (unsigned int i = 0; i < mNodes.size(); i++) {
+        Node const &node = mNodes[i];
+        if (node.mParent != -1)
+            stream << "    n" << i << " -> n" << node.mParent << " [arrowhead=empty];" << endl;
+        if (node.mEnclose != -1)
+            stream << "    n" << i << " -> n" << node.mEnclose << " [style=dashed];" << endl;
+        for (auto ms : node.mMemberClasses)
+            stream << "    n" << i << " -> n" << ms << " [style=dotted];" << endl;
+    }
+    stream << "}" << endl;
+    return OutputFile::Write(filepath, stream.str()) != OutputFile::Result::Error;
+}
+
+bool TypeGraph::WriteJson(path const &filepath, Games::IDs game) const {
+    auto names = [&](Vector<unsigned int> const &indices) {
+        json result = json::array();
+        for (auto index : indices)
+            result.push_back(mNodes[index].mStruct->GetFullName());
+        return result;
+    };
+    json structs = json::array();
+    for (unsigned int i = 0; i < mNodes.size(); i++) {
+        Node const &node = mNodes[i];
+        json js;
+        js["name"] = node.mStruct->GetFullName();
+        js["module"] = node.mStruct->mModule->mName;
+        if (node.mParent != -1)
+            js["parent"] = mNodes[node.mParent].mStruct->GetFullName();
+        js["children"] = names(node.mChildren);
+        js["numDescendants"] = node.GetNumDescendants();
+        if (node.mEnclose != -1)
+            js["enclose"] = mNodes[node.mEnclose].mStruct->GetFullName();
+        js["nested"] = names(node.mNested);
+        js["memberClasses"] = names(node.mMemberClasses);
+        structs.push_back(js);
+    }
+    json j;
+    j["game"] = Games::GetGameFolder(game);
+    j["structs"] = structs;
+    return OutputFile::Write(filepath, j.dump(4) + '\n') != OutputFile::Result::Error;
+}
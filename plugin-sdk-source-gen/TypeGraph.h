@@ -0,0 +1,45 @@
+#pragma once
+#include <string>
+#include <ostream>
+#include <filesystem>
+#include "ListEx.h"
+#include "..\shared\Games.h"
+
+using namespace std;
+using namespace std::experimental::filesystem;
+
+class Module;
+class Struct;
+class SymbolTable;
+class ModuleSet;
+
+// Graph of all structs of one game: inheritance (parent/child), enclose/nested and
+// by-value member edges. Built once, after the database is read; names are resolved here,
+// so later passes follow the edges instead of searching structs by name.
+class TypeGraph {
+public:
+    struct Node {
+        Struct *mStruct = nullptr;
+        int mParent = -1;
+        Vector<unsigned int> mChildren;
+        int mEnclose = -1;
+        Vector<unsigned int> mNested;
+        Vector<unsigned int> mMemberClasses; // structs used as by-value members
+        // descendants are mPreOrder[mFirst + 1, mLast); both are 0 if the node is in an inheritance cycle
+        unsigned int mFirst = 0;
+        unsigned int mLast = 0;
+
+        unsigned int GetNumDescendants() const { return mLast > mFirst ? mLast - mFirst - 1 : 0; }
+    };
+
+    Vector<Node> mNodes; // in module order, then in struct order inside module
+    Vector<unsigned int> mPreOrder; // depth-first order of inheritance trees
+
+    void Build(List<Module> &modules, SymbolTable &symbols);
+    Node const *GetNode(Struct const *s) const;
+    void CollectDescendantModules(Struct const *s, ModuleSet &modules) const; // modules of all derived structs
+
+    void WriteStats(ostream &stream) const;
+    bool WriteDot(path const &filepath, Games::IDs game) const;
+    bool WriteJson(path const &filepath, Games::IDs game) const;
+};
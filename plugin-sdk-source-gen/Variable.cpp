@@ -18,7 +18,7 @@ string Variable::GetNameWithRefType(bool bFullName) {
     return refType.BeforeName() + (bFullName ? GetFullName() : mName) + refType.AfterName();
 }
 
-void Variable::WriteDefinition(ofstream &stream, tabs t, Games::IDs game) {
+void Variable::WriteDefinition(CodeStream &stream, tabs t, Games::IDs game) {
     bool isConst = mType.mIsConst;
     if (mIsReadOnly)
         mType.mIsConst = true;
@@ -41,7 +41,7 @@ void Variable::WriteDefinition(ofstream &stream, tabs t, Games::IDs game) {
     mType.mIsConst = isConst;
 }
 
-void Variable::WriteDeclaration(ofstream &stream, tabs t, Games::IDs game, bool isStatic) {
+void Variable::WriteDeclaration(CodeStream &stream, tabs t, Games::IDs game, bool isStatic) {
     WriteComment(stream, mComment, t, 0);
     stream << t();
     stream << GameVersions::GetSupportedGameVersionsMacro(game, mVersionInfo) << ' ';
@@ -3,6 +3,7 @@
 #include "Type.h"
 #include "..\shared\Games.h"
 #include "Tabs.h"
+#include "CodeStream.h"
 
 using namespace std;
 
@@ -27,6 +28,6 @@ public:
     string GetFullName(); // combine name + scope
     string GetNameWithType(bool bFullName = false);
     string GetNameWithRefType(bool bFullName = false);
-    void WriteDefinition(ofstream &stream, tabs t, Games::IDs game);
-    void WriteDeclaration(ofstream &stream, tabs t, Games::IDs game, bool isStatic);
+    void WriteDefinition(CodeStream &stream, tabs t, Games::IDs game);
+    void WriteDeclaration(CodeStream &stream, tabs t, Games::IDs game, bool isStatic);
 };
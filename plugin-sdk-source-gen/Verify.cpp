@@ -0,0 +1,94 @@
+#include "..\shared\Utility.h"
+#include "Verify.h"
+#include "Generator.h"
+#include "OutputFile.h"
+#include <iostream>
+#include <map>
+#include <algorithm>
+
+bool Verify::Run(path const &sdkpath, path const &goldenpath, Options const &options) {
+    if (!is_directory(goldenpath))
+        return Message("Error: Golden folder '%s' does not exist", goldenpath.string().c_str());
+    OutputFile::StartCapture();
+    Generator::Generate(sdkpath, options);
+    auto capturedFiles = OutputFile::StopCapture();
+
+    // generated modules by path relative to modules folder; in incremental mode up-to-date modules
+    // are not generated, files from the previous run are compared instead
+    path modulesPath = sdkpath / "generated" / "modules";
+    map<path, string> files;
+    for (auto &entry : capturedFiles) {
+        path relativePath;
+        if (GetRelativePath(entry.first, modulesPath, relativePath))
+            files[relativePath] = move(entry.second);
+    }
+    unsigned int numSame = 0, numDifferent = 0, numMissing = 0, numUnexpected = 0;
+    for (auto const &p : recursive_directory_iterator(goldenpath)) {
+        if (!is_regular_file(p.path()))
+            continue;
+        path relativePath;
+        GetRelativePath(p.path(), goldenpath, relativePath);
+        string golden, generated;
+        Generator::ReadFileContent(p.path(), golden);
+        auto it = files.find(relativePath);
+        if (it != files.end()) {
+            generated = move(it->second);
+            files.erase(it);
+        }
+        else if (!Generator::ReadFileContent(modulesPath / relativePath, generated)) {
+            cout << "MISSING: " << relativePath << endl;
+            numMissing++;
+            continue;
+        }
+        // golden files are stored with LF line endings, generated files have CRLF on Windows
+        RemoveCarriageReturns(generated);
+        RemoveCarriageReturns(golden);
+        if (generated == golden)
+            numSame++;
+        else {
+            cout << "DIFFERENT: " << relativePath << " (line " << GetFirstDifferentLine(generated, golden) << ")" << endl;
+            numDifferent++;
+        }
+    }
+    for (auto const &entry : files) {
+        cout << "UNEXPECTED: " << entry.first << endl;
+        numUnexpected++;
+    }
+    cout << "Verify: " << numSame << " same, " << numDifferent << " different, " << numMissing << " missing, "
+        << numUnexpected << " unexpected" << endl;
+    return numDifferent == 0 && numMissing == 0 && numUnexpected == 0;
+}
+
+bool Verify::GetRelativePath(path const &filepath, path const &base, path &result) {
+    auto it = filepath.begin();
+    for (auto const &part : base) {
+        if (it == filepath.end() || *it != part)
+            return false;
+        ++it;
+    }
+    result.clear();
+    for (; it != filepath.end(); ++it)
+        result /= *it;
+    return true;
+}
+
+size_t Verify::GetFirstDifferentLine(string const &a, string const &b) {
+    // '\r' is skipped, so differences in line endings are not reported
+    size_t line = 1, i = 0, j = 0;
+    while (true) {
+        while (i < a.size() && a[i] == '\r')
+            i++;
+        while (j < b.size() && b[j] == '\r')
+            j++;
+        if (i == a.size() || j == b.size() || a[i] != b[j])
+            return line;
+        if (a[i] == '\n')
+            line++;
+        i++;
+        j++;
+    }
+}
+
+void Verify::RemoveCarriageReturns(string &text) {
+    text.erase(std::remove(text.begin(), text.end(), '\r'), text.end());
+}
@@ -0,0 +1,17 @@
+#pragma once
+#include <filesystem>
+#include "Options.h"
+
+using namespace std::experimental::filesystem;
+
+// Regression check (--verify <golden dir>): all games are generated in memory and the generated
+// modules are compared with golden copy of <sdk>/generated/modules. Generated files are not written.
+// Line endings are ignored: golden files have LF, generated files have CRLF on Windows.
+// tests/verify_fixture.py runs it on the fixture database (tests/fixture) in all generation modes.
+class Verify {
+public:
+    static bool Run(path const &sdkpath, path const &goldenpath, Options const &options);
+    static bool GetRelativePath(path const &filepath, path const &base, path &result); // false if filepath is not inside base
+    static size_t GetFirstDifferentLine(string const &a, string const &b); // 1-based, '\r' is ignored
+    static void RemoveCarriageReturns(string &text);
+};
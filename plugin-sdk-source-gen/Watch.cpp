@@ -0,0 +1,62 @@
+#include "Watch.h"
+#include "Generator.h"
+#include "JsonFileCache.h"
+#include "Hash.h"
+#include "Log.h"
+#include "Type.h"
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <chrono>
+
+void Watch::Run(path const &sdkpath, Options const &options) {
+    const unsigned int numGames = 3;
+    Options watchOptions = options;
+    watchOptions.mIncremental = true;
+    watchOptions.mSnapshot = false;
+    watchOptions.mPipeline = false;
+    JsonFileCache caches[numGames];
+    unsigned long long keys[numGames] = {};
+    path relationsPath = sdkpath / "database" / "module_relations.txt";
+    cout << "Watching " << (sdkpath / "database") << " for changes, press Ctrl+C to stop" << endl;
+    while (true) {
+        for (unsigned int i = 0; i < numGames; i++) {
+            Games::IDs game = Games::ToID(i);
+            auto inputFiles = Generator::GetInputFiles(sdkpath, game);
+            inputFiles.push_back(relationsPath);
+            // size and modification time of each file - polling must not read the files
+            unsigned long long key = Hash::Basis;
+            for (auto const &filepath : inputFiles)
+                key = Hash::Combine(Hash::Get(filepath.string(), key), JsonFileCache::GetFileStamp(filepath));
+            if (key == keys[i])
+                continue;
+            keys[i] = key;
+            auto start = chrono::steady_clock::now();
+            ostringstream gameLog;
+            Log::SetStream(&gameLog);
+            {
+                // the model is rebuilt from cached files - struct links and vtables are created
+                // by UpdateModules(), so it is simpler to build them again than to patch them
+                GameData data(game, watchOptions.mArena);
+                data.mJsonCache = &caches[i];
+                Generator::ReadStage(sdkpath, data, watchOptions);
+                Generator::UpdateStage(sdkpath, data, watchOptions);
+                Generator::WriteStage(sdkpath, data, watchOptions);
+            }
+            // spellings from edited files would stay in the type cache for the whole session;
+            // parsed files are kept in JsonFileCache, so the cache is filled again only for changed files
+            Type::ClearCache();
+            Log::SetStream(nullptr);
+            // full log lists every database file, only written modules and errors are printed
+            istringstream logLines(gameLog.str());
+            for (string line; getline(logLines, line); ) {
+                if (line.find("Writing module '") != string::npos || line.find("ERROR") != string::npos || line.find("WARNING") != string::npos)
+                    cout << line << endl;
+            }
+            auto elapsed = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start);
+            cout << "GTA " << Games::GetGameAbbr(game) << " updated in " << elapsed.count() << " ms (" << caches[i].mNumParsed
+                << " files parsed, " << caches[i].mNumReused << " reused)" << endl;
+        }
+        this_thread::sleep_for(chrono::milliseconds(PollInterval));
+    }
+}
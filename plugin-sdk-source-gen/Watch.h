@@ -0,0 +1,16 @@
+#pragma once
+#include <filesystem>
+#include "Options.h"
+
+using namespace std::experimental::filesystem;
+
+// Watch mode (--watch): the database folder is checked for changes (file sizes and modification times),
+// and the game is generated again when any of its files changes. Unchanged json and csv files are not
+// parsed again (JsonFileCache), modules are written in incremental mode, so only the modules affected
+// by the change are written.
+class Watch {
+public:
+    static const unsigned int PollInterval = 250; // milliseconds
+
+    static void Run(path const &sdkpath, Options const &options);
+};
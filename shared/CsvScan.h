@@ -0,0 +1,132 @@
+#pragma once
+#include <cstddef>
+
+// CSVSCAN_SCALAR disables SIMD search (used to test the scalar loop on SSE2/AVX2 targets)
+#if !defined(CSVSCAN_SCALAR)
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define CSVSCAN_SSE2
+#include <emmintrin.h>
+#endif
+// AVX2 search is compiled for all x86/x64 targets (no /arch:AVX2 needed) and is selected at startup
+// if the CPU and OS support it; CSVSCAN_NO_AVX2 disables it
+#if !defined(CSVSCAN_NO_AVX2) && (defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__))
+#define CSVSCAN_AVX2
+#include <immintrin.h>
+#endif
+#endif
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#if defined(CSVSCAN_AVX2) && !defined(_MSC_VER) && !defined(__AVX2__)
+#define CSVSCAN_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define CSVSCAN_TARGET_AVX2
+#endif
+
+// Search for CSV special characters (',' '"' '\r' '\n'), 32 (AVX2) or 16 (SSE2) bytes at a time.
+// Used by CSV readers to skip plain field characters.
+
+class CsvScan {
+    static inline unsigned int FirstBit(unsigned int mask) {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward(&index, mask);
+        return index;
+#else
+        return __builtin_ctz(mask);
+#endif
+    }
+
+    static inline bool IsSpecial(char c) {
+        return c == ',' || c == '"' || c == '\r' || c == '\n';
+    }
+
+#if defined(CSVSCAN_AVX2)
+    static bool DetectAvx2() {
+#if defined(__AVX2__)
+        return true;
+#elif defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 0);
+        if (info[0] < 7)
+            return false;
+        __cpuid(info, 1);
+        if ((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0) // OSXSAVE, AVX
+            return false;
+        if ((_xgetbv(0) & 6) != 6) // OS saves XMM and YMM registers
+            return false;
+        __cpuidex(info, 7, 0);
+        return (info[1] & (1 << 5)) != 0; // AVX2
+#else
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2");
+#endif
+    }
+
+    static inline bool const UseAvx2 = DetectAvx2();
+
+    // index of the first special character in range [pos;size), or the position where less than 32 bytes remain
+    CSVSCAN_TARGET_AVX2 static size_t FindSpecialAvx2(char const *data, size_t size, size_t pos) {
+        const __m256i comma32 = _mm256_set1_epi8(',');
+        const __m256i quote32 = _mm256_set1_epi8('"');
+        const __m256i cr32 = _mm256_set1_epi8('\r');
+        const __m256i lf32 = _mm256_set1_epi8('\n');
+        while (pos + 32 <= size) {
+            __m256i block = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(data + pos));
+            __m256i match = _mm256_or_si256(
+                _mm256_or_si256(_mm256_cmpeq_epi8(block, comma32), _mm256_cmpeq_epi8(block, quote32)),
+                _mm256_or_si256(_mm256_cmpeq_epi8(block, cr32), _mm256_cmpeq_epi8(block, lf32)));
+            unsigned int mask = static_cast<unsigned int>(_mm256_movemask_epi8(match));
+            if (mask) {
+                _mm256_zeroupper();
+                return pos + FirstBit(mask);
+            }
+            pos += 32;
+        }
+        _mm256_zeroupper(); // avoid AVX-SSE transition penalty in non-VEX code
+        return pos;
+    }
+#endif
+
+public:
+    // search mode used by FindSpecial: "AVX2", "SSE2" or "scalar"
+    static char const *Mode() {
+#if defined(CSVSCAN_AVX2)
+        if (UseAvx2)
+            return "AVX2";
+#endif
+#if defined(CSVSCAN_SSE2)
+        return "SSE2";
+#else
+        return "scalar";
+#endif
+    }
+
+    // index of the first special character in range [pos;size), or 'size' if there's none
+    static inline size_t FindSpecial(char const *data, size_t size, size_t pos) {
+#if defined(CSVSCAN_AVX2)
+        if (UseAvx2)
+            pos = FindSpecialAvx2(data, size, pos); // found character or the last bytes are handled below
+#endif
+#if defined(CSVSCAN_SSE2)
+        const __m128i comma = _mm_set1_epi8(',');
+        const __m128i quote = _mm_set1_epi8('"');
+        const __m128i cr = _mm_set1_epi8('\r');
+        const __m128i lf = _mm_set1_epi8('\n');
+        while (pos + 16 <= size) {
+            __m128i block = _mm_loadu_si128(reinterpret_cast<__m128i const *>(data + pos));
+            __m128i match = _mm_or_si128(
+                _mm_or_si128(_mm_cmpeq_epi8(block, comma), _mm_cmpeq_epi8(block, quote)),
+                _mm_or_si128(_mm_cmpeq_epi8(block, cr), _mm_cmpeq_epi8(block, lf)));
+            unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(match));
+            if (mask)
+                return pos + FirstBit(mask);
+            pos += 16;
+        }
+#endif
+        while (pos < size && !IsSpecial(data[pos]))
+            pos++;
+        return pos;
+    }
+};
@@ -5,7 +5,7 @@
 
 template <typename ...ArgTypes>
 bool Message(char *message, ArgTypes... args) {
-    static char text[512];
+    char text[512];
     sprintf_s(text, message, args...);
     MessageBoxA(NULL, text, "Message", 0);
     return false;
@@ -13,7 +13,7 @@ bool Message(char *message, ArgTypes... args) {
 
 template <typename ...ArgTypes>
 bool Message(char const *message, ArgTypes... args) {
-    static char text[512];
+    char text[512];
     sprintf_s(text, message, args...);
     MessageBoxA(NULL, text, "Message", 0);
     return false;
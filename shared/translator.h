@@ -6,6 +6,8 @@
 #include "translators\gtavc_steam_translator.h"
 #include "translators\gta3_11en_translator.h"
 #include "translators\gta3_steam_translator.h"
+#include <iterator>
+#include <algorithm>
 
 inline unsigned int translateAddr(Games::IDs game, unsigned int version, unsigned int address) {
     switch (game) {
@@ -43,9 +45,175 @@ inline unsigned int translateAddr(Games::IDs game, unsigned int version, unsigne
         case 1: // 11en
             return translate_gta3_11en(address);
         case 2: // steam
-            return translate_gta3_11en_to_steam(translate_gta3_11en(address));
+            return translate_gta3_steam(address);
         }
         break;
     }
     return 0;
 }
+
+// translation table for given version; ranges is nullptr for base versions (addresses are not changed),
+// returns false for versions which are not supported
+inline bool getAddrRanges(Games::IDs game, unsigned int version, AddressRange const *&ranges, size_t &count) {
+    ranges = nullptr;
+    count = 0;
+    switch (game) {
+    case Games::GTASA:
+        switch (version) {
+        case 0: // 10us compact
+        case 1: // 10us hoodlum
+            return true;
+        case 2: // 10eu
+            ranges = gtasa_10eu_ranges;
+            count = std::size(gtasa_10eu_ranges);
+            return true;
+        }
+        break;
+    case Games::GTAVC:
+        switch (version) {
+        case 0: // 10en
+            return true;
+        case 1: // 11en
+            ranges = gtavc_11en_ranges;
+            count = std::size(gtavc_11en_ranges);
+            return true;
+        case 2: // steam
+            ranges = gtavc_steam_ranges;
+            count = std::size(gtavc_steam_ranges);
+            return true;
+        }
+        break;
+    case Games::GTA3:
+        switch (version) {
+        case 0: // 10en
+            return true;
+        case 1: // 11en
+            ranges = gta3_11en_ranges;
+            count = std::size(gta3_11en_ranges);
+            return true;
+        case 2: // steam
+            ranges = gta3_steam_ranges.mRanges;
+            count = std::size(gta3_steam_ranges.mRanges);
+            return true;
+        }
+        break;
+    }
+    return false;
+}
+
+// translate 'count' addresses at once, same as translateAddr() for each address ('in' and 'out' may be the same array)
+inline void translateAddrs(Games::IDs game, unsigned int version, unsigned int const *in, unsigned int *out, size_t count) {
+    AddressRange const *ranges;
+    size_t numRanges;
+    if (!getAddrRanges(game, version, ranges, numRanges))
+        std::fill(out, out + count, 0);
+    else if (!ranges) {
+        if (in != out)
+            std::copy(in, in + count, out);
+    }
+    else
+        translateAddrRanges(ranges, numRanges, in, out, count);
+}
+
+// address in base version (10us/10en) for address in given version; 0 if there's no such address
+inline unsigned int untranslateAddr(Games::IDs game, unsigned int version, unsigned int address) {
+    switch (game) {
+    case Games::GTASA:
+        switch (version) {
+        case 0: // 10us compact
+        case 1: // 10us hoodlum
+            return address;
+        case 2: // 10eu
+            return untranslate_gtasa_10eu(address);
+        case 3: // 11us
+        case 4: // 11eu
+        case 5: // sr2
+        case 6: // sr2lv
+            return 0;
+        }
+        break;
+    case Games::GTAVC:
+        switch (version) {
+        case 0: // 10en
+            return address;
+        case 1: // 11en
+            return untranslate_gtavc_11en(address);
+        case 2: // steam
+            return untranslate_gtavc_steam(address);
+        }
+        break;
+    case Games::GTA3:
+        switch (version) {
+        case 0: // 10en
+            return address;
+        case 1: // 11en
+            return untranslate_gta3_11en(address);
+        case 2: // steam
+            return untranslate_gta3_steam(address);
+        }
+        break;
+    }
+    return 0;
+}
+
+// reverse table for given version (see getAddrRanges()); ranges is nullptr for base versions
+inline bool getReverseAddrRanges(Games::IDs game, unsigned int version, AddressRange const *&ranges, size_t &count) {
+    ranges = nullptr;
+    count = 0;
+    switch (game) {
+    case Games::GTASA:
+        switch (version) {
+        case 0: // 10us compact
+        case 1: // 10us hoodlum
+            return true;
+        case 2: // 10eu
+            ranges = gtasa_10eu_reverse_ranges.mRanges;
+            count = std::size(gtasa_10eu_reverse_ranges.mRanges);
+            return true;
+        }
+        break;
+    case Games::GTAVC:
+        switch (version) {
+        case 0: // 10en
+            return true;
+        case 1: // 11en
+            ranges = gtavc_11en_reverse_ranges.mRanges;
+            count = std::size(gtavc_11en_reverse_ranges.mRanges);
+            return true;
+        case 2: // steam
+            ranges = gtavc_steam_reverse_ranges.mRanges;
+            count = std::size(gtavc_steam_reverse_ranges.mRanges);
+            return true;
+        }
+        break;
+    case Games::GTA3:
+        switch (version) {
+        case 0: // 10en
+            return true;
+        case 1: // 11en
+            ranges = gta3_11en_reverse_ranges.mRanges;
+            count = std::size(gta3_11en_reverse_ranges.mRanges);
+            return true;
+        case 2: // steam
+            ranges = gta3_steam_reverse_ranges.mRanges;
+            count = std::size(gta3_steam_reverse_ranges.mRanges);
+            return true;
+        }
+        break;
+    }
+    return false;
+}
+
+// untranslate 'count' addresses at once, same as untranslateAddr() for each address ('in' and 'out' may be the same array)
+inline void untranslateAddrs(Games::IDs game, unsigned int version, unsigned int const *in, unsigned int *out, size_t count) {
+    AddressRange const *ranges;
+    size_t numRanges;
+    if (!getReverseAddrRanges(game, version, ranges, numRanges))
+        std::fill(out, out + count, 0);
+    else if (!ranges) {
+        if (in != out)
+            std::copy(in, in + count, out);
+    }
+    else
+        translateAddrRanges(ranges, numRanges, in, out, count);
+}
@@ -0,0 +1,183 @@
+#pragma once
+#include <cstddef>
+#include <algorithm>
+
+// Address translation table: sorted ranges, each range ends where the next one starts.
+// The first range starts at address 0 (address 0 is never translated).
+struct AddressRange {
+    unsigned int mStart;  // first address of the range
+    int mOffset;          // added to addresses from this range
+    bool mMapped = true;  // false - addresses from this range don't exist in target version (translated to 0)
+};
+
+// Branchless binary search for the last range which starts at or before the address
+inline unsigned int translateAddrRanges(AddressRange const *ranges, size_t count, unsigned int address) {
+    AddressRange const *range = ranges;
+    while (count > 1) {
+        size_t half = count / 2;
+        range = (range[half].mStart <= address) ? range + half : range;
+        count -= half;
+    }
+    return range->mMapped ? address + static_cast<unsigned int>(range->mOffset) : 0;
+}
+
+template<size_t Count>
+inline unsigned int translateAddrRanges(AddressRange const (&ranges)[Count], unsigned int address) {
+    return translateAddrRanges(ranges, Count, address);
+}
+
+// Batch translation ('in' and 'out' may be the same array). Sorted input is translated in one pass
+// over the table; for unsorted input the searches for 8 addresses are interleaved, so their loads overlap.
+inline void translateAddrRanges(AddressRange const *ranges, size_t count, unsigned int const *in, unsigned int *out, size_t numAddresses) {
+    if (std::is_sorted(in, in + numAddresses)) {
+        size_t r = 0;
+        for (size_t i = 0; i < numAddresses; i++) {
+            while (r + 1 < count && ranges[r + 1].mStart <= in[i])
+                r++;
+            out[i] = ranges[r].mMapped ? in[i] + static_cast<unsigned int>(ranges[r].mOffset) : 0;
+        }
+        return;
+    }
+    const size_t numLanes = 8;
+    size_t i = 0;
+    for (; i + numLanes <= numAddresses; i += numLanes) {
+        AddressRange const *range[numLanes];
+        for (size_t lane = 0; lane < numLanes; lane++)
+            range[lane] = ranges;
+        for (size_t n = count; n > 1; ) {
+            size_t half = n / 2;
+            for (size_t lane = 0; lane < numLanes; lane++)
+                range[lane] = (range[lane][half].mStart <= in[i + lane]) ? range[lane] + half : range[lane];
+            n -= half;
+        }
+        for (size_t lane = 0; lane < numLanes; lane++)
+            out[i + lane] = range[lane]->mMapped ? in[i + lane] + static_cast<unsigned int>(range[lane]->mOffset) : 0;
+    }
+    for (; i < numAddresses; i++)
+        out[i] = translateAddrRanges(ranges, count, in[i]);
+}
+
+// Composition of two tables: translation with the first table, then with the second one.
+// Writes the ranges to 'out' (if it's not nullptr) and returns their count.
+constexpr size_t composeAddrRanges(AddressRange const *first, size_t firstCount, AddressRange const *second, size_t secondCount,
+    AddressRange *out)
+{
+    const unsigned long long addressSpaceEnd = 0x100000000ull;
+    size_t count = 0;
+    AddressRange last = { 0, 0, false };
+    auto Add = [&](AddressRange range) {
+        // adjacent ranges with the same translation are merged
+        if (count > 0 && last.mMapped == range.mMapped && (!range.mMapped || last.mOffset == range.mOffset))
+            return;
+        if (out)
+            out[count] = range;
+        last = range;
+        count++;
+    };
+    for (size_t i = 0; i < firstCount; i++) {
+        AddressRange const &a = first[i];
+        unsigned long long end = (i + 1 < firstCount) ? first[i + 1].mStart : addressSpaceEnd;
+        if (!a.mMapped) {
+            Add({ a.mStart, 0, false });
+            continue;
+        }
+        // the range is split where translated address enters the next range of the second table
+        for (unsigned long long x = a.mStart; x < end; ) {
+            unsigned int y = static_cast<unsigned int>(x) + static_cast<unsigned int>(a.mOffset);
+            size_t j = 0;
+            while (j + 1 < secondCount && second[j + 1].mStart <= y)
+                j++;
+            AddressRange const &b = second[j];
+            if (b.mMapped)
+                Add({ static_cast<unsigned int>(x), static_cast<int>(static_cast<unsigned int>(a.mOffset) + static_cast<unsigned int>(b.mOffset)) });
+            else
+                Add({ static_cast<unsigned int>(x), 0, false });
+            unsigned long long yEnd = (j + 1 < secondCount) ? second[j + 1].mStart : addressSpaceEnd;
+            x += yEnd - y;
+        }
+    }
+    return count;
+}
+
+template<size_t CountA, size_t CountB>
+constexpr size_t countComposedAddrRanges(AddressRange const (&first)[CountA], AddressRange const (&second)[CountB]) {
+    return composeAddrRanges(first, CountA, second, CountB, nullptr);
+}
+
+// Fused table, computed at compile time:
+//     inline constexpr size_t a_to_c_count = countComposedAddrRanges(a_to_b_ranges, b_to_c_ranges);
+//     inline constexpr auto a_to_c = composeAddrRanges<a_to_c_count>(a_to_b_ranges, b_to_c_ranges);
+// Longer chains are composed from fused tables (a_to_c.mRanges).
+template<size_t Count>
+struct AddressRangeTable {
+    AddressRange mRanges[Count] = {};
+};
+
+template<size_t Count, size_t CountA, size_t CountB>
+constexpr AddressRangeTable<Count> composeAddrRanges(AddressRange const (&first)[CountA], AddressRange const (&second)[CountB]) {
+    AddressRangeTable<Count> result;
+    composeAddrRanges(first, CountA, second, CountB, result.mRanges);
+    return result;
+}
+
+// Reverse table: for each address of the target version, the source address which is translated to it.
+// Target addresses which no source address is translated to (holes and unmapped ranges) are untranslated to 0;
+// if several source ranges are translated to the same addresses, the first of these ranges is used.
+template<size_t CountA>
+constexpr size_t invertAddrRanges(AddressRange const (&ranges)[CountA], AddressRange *out) {
+    const unsigned long long addressSpaceEnd = 0x100000000ull;
+    // target ranges are split at the first and the last address of each translated range
+    unsigned long long points[2 * CountA + 2] = {};
+    size_t numPoints = 0;
+    auto AddPoint = [&](unsigned long long point) {
+        size_t i = numPoints++;
+        for (; i > 0 && points[i - 1] > point; i--)
+            points[i] = points[i - 1];
+        points[i] = point;
+    };
+    AddPoint(0);
+    AddPoint(1);
+    for (size_t i = 0; i < CountA; i++) {
+        if (ranges[i].mMapped) {
+            unsigned long long end = (i + 1 < CountA) ? ranges[i + 1].mStart : addressSpaceEnd;
+            AddPoint(static_cast<unsigned int>(ranges[i].mStart + static_cast<unsigned int>(ranges[i].mOffset)));
+            AddPoint(static_cast<unsigned int>(end + static_cast<unsigned int>(ranges[i].mOffset)));
+        }
+    }
+    size_t count = 0;
+    AddressRange last = { 0, 0, false };
+    for (size_t p = 0; p < numPoints; p++) {
+        if (p > 0 && points[p] == points[p - 1])
+            continue;
+        AddressRange range = { static_cast<unsigned int>(points[p]), 0, false };
+        for (size_t i = 0; i < CountA && range.mStart != 0; i++) {
+            if (!ranges[i].mMapped)
+                continue;
+            unsigned long long end = (i + 1 < CountA) ? ranges[i + 1].mStart : addressSpaceEnd;
+            unsigned int targetStart = ranges[i].mStart + static_cast<unsigned int>(ranges[i].mOffset);
+            if (static_cast<unsigned int>(range.mStart - targetStart) < end - ranges[i].mStart) {
+                range = { range.mStart, static_cast<int>(0u - static_cast<unsigned int>(ranges[i].mOffset)) };
+                break;
+            }
+        }
+        if (count > 0 && last.mMapped == range.mMapped && (!range.mMapped || last.mOffset == range.mOffset))
+            continue;
+        if (out)
+            out[count] = range;
+        last = range;
+        count++;
+    }
+    return count;
+}
+
+template<size_t CountA>
+constexpr size_t countInvertedAddrRanges(AddressRange const (&ranges)[CountA]) {
+    return invertAddrRanges(ranges, nullptr);
+}
+
+template<size_t Count, size_t CountA>
+constexpr AddressRangeTable<Count> invertAddrRanges(AddressRange const (&ranges)[CountA]) {
+    AddressRangeTable<Count> result;
+    invertAddrRanges(ranges, result.mRanges);
+    return result;
+}
@@ -1,201 +1,117 @@
 #pragma once
+#include "address_ranges.h"
 
 /*
     https://github.com/DK22Pac/plugin-sdk-tools
     Dmitri K. / DK22Pac ©
 */
 
+// GTA III 1.0 -> 1.1 address ranges
+inline constexpr AddressRange gta3_11en_ranges[] = {
+    { 0x000000, 0, false },
+    { 0x000001, 0 },
+    { 0x461730, 0x10 },
+    { 0x46B0D0, 0, false },
+    { 0x46B100, -0x20 },
+    { 0x46B1F0, -0x30 },
+    { 0x46BEB0, -0x20 },
+    { 0x4731C0, 0 },
+    { 0x47A440, -0x10 },
+    { 0x47F2B0, 0xD0 },
+    { 0x488420, 0x100 },
+    { 0x489270, 0x110 },
+    { 0x48AE60, 0xF0 },
+    { 0x48C4B0, 0x100 },
+    { 0x48DA20, 0, false },
+    { 0x48DA50, 0xD0 },
+    { 0x48DD60, 0xC0 },
+    { 0x499890, 0xF0 },
+    { 0x4C1B50, 0xA0 },
+    { 0x4DD5D0, 0xB0 },
+    { 0x4F6CE0, 0xE0 },
+    { 0x50B850, 0xF0 },
+    { 0x50D140, 0x1F0 },
+    { 0x511B90, 0x210 },
+    { 0x518130, 0x230 },
+    { 0x521770, 0x240 },
+    { 0x5454A0, 0, false },
+    { 0x5454D0, 0x210 },
+    { 0x545760, 0x200 },
+    { 0x54A610, 0, false },
+    { 0x54A640, 0x1D0 },
+    { 0x54A8A0, 0x1C0 },
+    { 0x54A950, 0, false },
+    { 0x54A980, 0x190 },
+    { 0x54A9B0, 0x180 },
+    { 0x54DFD0, 0, false },
+    { 0x54E000, 0x150 },
+    { 0x54E100, 0x140 },
+    { 0x554CA0, 0x170 },
+    { 0x554E70, 0, false },
+    { 0x554EA0, 0x140 },
+    { 0x554FE0, 0x130 },
+    { 0x564D00, 0x140 },
+    { 0x566DC0, 0x310 },
+    { 0x566F20, 0x320 },
+    { 0x566F50, 0x350 },
+    { 0x581460, 0x340 },
+    { 0x58B7A0, 0x2F0 },
+    { 0x5909D0, 0, false },
+    { 0x590A00, 0x2C0 },
+    { 0x591910, 0x2B0 },
+    { 0x5973F0, 0, false },
+    { 0x597420, 0x280 },
+    { 0x597560, 0x270 },
+    { 0x598B30, 0x280 },
+    { 0x598B80, 0x2C0 },
+    { 0x5E3220, 0, false },
+    { 0x5E4000, 0 },
+    { 0x5F094C, 0, false },
+    { 0x5F0A58, -0x108 },
+    { 0x5F3F48, 0, false },
+    { 0x5F3F4C, -0x10C },
+    { 0x5F4C08, 0, false },
+    { 0x5F4C0C, -0x110 },
+    { 0x5F560C, 0, false },
+    { 0x5F5714, -0x218 },
+    { 0x5FDD9C, -0x214 },
+    { 0x5FDDE0, -0x218 },
+    { 0x60109C, 0, false },
+    { 0x6011A4, -0x320 },
+    { 0x601BE0, 0, false },
+    { 0x601CE8, -0x428 },
+    { 0x601D08, 0, false },
+    { 0x601E10, -0x530 },
+    { 0x602070, 0, false },
+    { 0x60217C, -0x638 },
+    { 0x602698, -0x634 },
+    { 0x60269C, -0x630 },
+    { 0x602958, 0, false },
+    { 0x602A60, -0x738 },
+    { 0x611574, 0, false },
+    { 0x61167C, -0x840 },
+    { 0x617DA4, 0, false },
+    { 0x617EAC, -0x948 },
+    { 0x618030, -0x934 },
+    { 0x618034, 0, false },
+    { 0x618038, -0x938 },
+    { 0x61C000, 0 },
+    { 0x8472E0, -0x50 },
+    { 0x8E2A6C, 0xB4 },
+    { 0x8F6000, 0x1B8 },
+    { 0x95CD95, 0x1B9 },
+    { 0x95CDAD, -0x35F229 },
+    { 0x95CDAE, 0x1B8 },
+};
+
 inline unsigned int translate_gta3_11en(unsigned int address) {
-    if (address == 0)
-        return 0;
-    // .bss
-    if (address >= 0x95CDAE)
-        return address + 0x1B8;
-    if (address == 0x95CDAD)
-        return 0x5FDB84;
-    if (address >= 0x95CD95)
-        return address + 0x1B9;
-    if (address >= 0x8F6000)
-        return address + 0x1B8;
-    if (address >= 0x8E2A6C)
-        return address + 0xB4;
-    if (address >= 0x8472E0)
-        return address - 0x50;
-    // .CRT
-    if (address >= 0x61C000)
-        return address;
-    // .data
-    if (address >= 0x618038)
-        return address - 0x938;
-    if (address >= 0x618034 && address < 0x618038)
-        return 0;
-    if (address >= 0x618030)
-        return address - 0x934;
-    if (address >= 0x617EAC)
-        return address - 0x948;
-    if (address >= 0x617DA4 && address < 0x617EAC)
-        return 0;
-    if (address >= 0x61167C)
-        return address - 0x840;
-    if (address >= 0x611574 && address < 0x61167C)
-        return 0;
-    if (address >= 0x602A60)
-        return address - 0x738;
-    if (address >= 0x602958 && address < 0x602A60)
-        return 0;
-    if (address >= 0x60269C)
-        return address - 0x630;
-    if (address >= 0x602698)
-        return address - 0x634;
-    if (address >= 0x60217C)
-        return address - 0x638;
-    if (address >= 0x602070 && address < 0x60217C)
-        return 0;
-    if (address >= 0x601E10)
-        return address - 0x530;
-    if (address >= 0x601D08 && address < 0x601E10)
-        return 0;
-    if (address >= 0x601CE8)
-        return address - 0x428;
-    if (address >= 0x601BE0 && address < 0x601CE8)
-        return 0;
-    if (address >= 0x6011A4)
-        return address - 0x320;
-    if (address >= 0x60109C && address < 0x6011A4)
-        return 0;
-    if (address >= 0x5FDDE0)
-        return address - 0x218;
-    if (address >= 0x5FDD9C)
-        return address - 0x214;
-    if (address >= 0x5F5714)
-        return address - 0x218;
-    if (address >= 0x5F560C && address < 0x5F5714)
-        return 0;
-    if (address >= 0x5F4C0C)
-        return address - 0x110;
-    if (address >= 0x5F4C08 && address < 0x5F4C0C)
-        return 0;
-    if (address >= 0x5F3F4C)
-        return address - 0x10C;
-    if (address >= 0x5F3F48 && address < 0x5F3F4C)
-        return 0;
-    if (address >= 0x5F0A58)
-        return address - 0x108;
-    if (address >= 0x5F094C && address < 0x5F0A58)
-        return 0;
-    // _rwcseg
-    if (address >= 0x5E4000)
-        return address;
-    // .text
-    if (address >= 0x5E3220)
-        return 0;
-    if (address >= 0x598B80)
-        return address + 0x2C0;
-    if (address >= 0x598B30)
-        return address + 0x280;
-    if (address >= 0x597560)
-        return address + 0x270;
-    if (address >= 0x597420)
-        return address + 0x280;
-    if (address >= 0x5973F0 && address < 0x597420)
-        return 0;
-    if (address >= 0x591910)
-        return address + 0x2B0;
-    if (address >= 0x590A00)
-        return address + 0x2C0;
-    if (address >= 0x5909D0 && address < 0x590A00)
-        return 0;
-    if (address >= 0x58B7A0)
-        return address + 0x2F0;
-    if (address >= 0x581460)
-        return address + 0x340;
-    if (address >= 0x566F50)
-        return address + 0x350;
-    if (address >= 0x566F20)
-        return address + 0x320;
-    if (address >= 0x566DC0)
-        return address + 0x310;
-    if (address >= 0x564D00)
-        return address + 0x140;
-    if (address >= 0x554FE0)
-        return address + 0x130;
-    if (address >= 0x554EA0)
-        return address + 0x140;
-    if (address >= 0x554E70 && address < 0x554EA0)
-        return 0;
-    if (address >= 0x554CA0)
-        return address + 0x170;
-    if (address >= 0x54E100)
-        return address + 0x140;
-    if (address >= 0x54E000)
-        return address + 0x150;
-    if (address >= 0x54DFD0 && address < 0x54E000)
-        return 0;
-    if (address >= 0x54A9B0)
-        return address + 0x180;
-    if (address >= 0x54A980)
-        return address + 0x190;
-    if (address >= 0x54A950 && address < 0x54A980)
-        return 0;
-    if (address >= 0x54A8A0)
-        return address + 0x1C0;
-    if (address >= 0x54A640)
-        return address + 0x1D0;
-    if (address >= 0x54A610 && address < 0x54A640)
-        return 0;
-    if (address >= 0x545760)
-        return address + 0x200;
-    if (address >= 0x5454D0)
-        return address + 0x210;
-    if (address >= 0x5454A0 && address < 0x5454D0)
-        return 0;
-    if (address >= 0x521770)
-        return address + 0x240;
-    if (address >= 0x518130)
-        return address + 0x230;
-    if (address >= 0x511B90)
-        return address + 0x210;
-    if (address >= 0x50D140)
-        return address + 0x1F0;
-    if (address >= 0x50B850)
-        return address + 0xF0;
-    if (address >= 0x4F6CE0)
-        return address + 0xE0;
-    if (address >= 0x4DD5D0)
-        return address + 0xB0;
-    if (address >= 0x4C1B50)
-        return address + 0xA0;
-    if (address >= 0x499890)
-        return address + 0xF0;
-    if (address >= 0x48DD60)
-        return address + 0xC0;
-    if (address >= 0x48DA50)
-        return address + 0xD0;
-    if (address >= 0x48DA20 && address < 0x48DA50)
-        return 0;
-    if (address >= 0x48C4B0)
-        return address + 0x100;
-    if (address >= 0x48AE60)
-        return address + 0xF0;
-    if (address >= 0x489270)
-        return address + 0x110;
-    if (address >= 0x488420)
-        return address + 0x100;
-    if (address >= 0x47F2B0)
-        return address + 0xD0;
-    if (address >= 0x47A440)
-        return address - 0x10;
-    if (address >= 0x4731C0)
-        return address;
-    if (address >= 0x46BEB0)
-        return address - 0x20;
-    if (address >= 0x46B1F0)
-        return address - 0x30;
-    if (address >= 0x46B100)
-        return address - 0x20;
-    if (address >= 0x46B0D0 && address < 0x46B100)
-        return 0;
-    if (address >= 0x461730)
-        return address + 0x10;
-    return address;
+    return translateAddrRanges(gta3_11en_ranges, address);
+}
+
+// GTA III 1.1 -> 1.0: reverse table
+inline constexpr size_t gta3_11en_reverse_count = countInvertedAddrRanges(gta3_11en_ranges);
+inline constexpr auto gta3_11en_reverse_ranges = invertAddrRanges<gta3_11en_reverse_count>(gta3_11en_ranges);
+
+inline unsigned int untranslate_gta3_11en(unsigned int address) {
+    return translateAddrRanges(gta3_11en_reverse_ranges.mRanges, address);
 }
@@ -1,4 +1,6 @@
 #pragma once
+#include "address_ranges.h"
+#include "gta3_11en_translator.h"
 
 /*
     https://github.com/DK22Pac/plugin-sdk-tools
@@ -7,69 +9,51 @@
 
 // Most of RW functions and variables are not 'translated'!
 
-inline unsigned int translate_gta3_11en_to_steam(unsigned int address) {
-    if (address == 0)
-        return 0;
-
-    // .bss
-
-    if (address >= 0x663EC0)
-        return address + 0x10140;
-    // other RW data
-    if (address >= 0x661010)
-        return 0;
-    if (address >= 0x661010)
-        return address + 0x10010;
-    if (address >= 0x660FF8)
-        return address + 0xFF88;
-    if (address >= 0x660F78)
-        return address + 0x10020;
-    if (address >= 0x64C618)
-        return address + 0x10008;
-    if (address >= 0x621000)
-        return address + 0x10000;
+// GTA III 1.1 -> Steam address ranges
+inline constexpr AddressRange gta3_11en_to_steam_ranges[] = {
+    { 0x000000, 0, false },
+    { 0x000001, 0 },
+    { 0x48AEE0, 0, false },
+    { 0x48AF50, -0x70 },
+    { 0x53A090, -0x50 },
+    { 0x5670D0, -0x80 },
+    { 0x567240, -0x100 },
+    { 0x581FD0, -0x110 },
+    { 0x598E70, 0x11D0 },
+    { 0x59BC70, -0x2F10 },
+    { 0x59CF50, -0x110 },
+    { 0x59E8B0, 0, false },
+    { 0x5EA000, 0xD000 },
+    { 0x5F3E10, 0xCFF8 },
+    { 0x617700, 0xD140 },
+    { 0x6178F0, 0xCE08 },
+    { 0x617A38, 0xCFF8 },
+    { 0x618520, 0xD000 },
+    { 0x618638, 0, false },
+    { 0x621000, 0x10000 },
+    { 0x64C618, 0x10008 },
+    { 0x660F78, 0x10020 },
+    { 0x660FF8, 0xFF88 },
+    { 0x661010, 0, false },
+    { 0x663EC0, 0x10140 },
+};
 
-    // .data
+inline unsigned int translate_gta3_11en_to_steam(unsigned int address) {
+    return translateAddrRanges(gta3_11en_to_steam_ranges, address);
+}
 
-    // other RW data
-    if (address >= 0x618638)
-        return 0;
-    if (address >= 0x618520)
-        return address + 0xD000;
-    if (address >= 0x617A38)
-        return address + 0xCFF8;
-    if (address >= 0x6178F0)
-        return address + 0xCE08;
-    if (address >= 0x617700)
-        return address + 0xD140;
-    if (address >= 0x5F3E10)
-        return address + 0xCFF8;
-    if (address >= 0x5EA000)
-        return address + 0xD000;
+// GTA III 1.0 -> Steam: 1.0 -> 1.1 and 1.1 -> Steam tables fused at compile time
+inline constexpr size_t gta3_steam_count = countComposedAddrRanges(gta3_11en_ranges, gta3_11en_to_steam_ranges);
+inline constexpr auto gta3_steam_ranges = composeAddrRanges<gta3_steam_count>(gta3_11en_ranges, gta3_11en_to_steam_ranges);
 
-    // .text
+inline unsigned int translate_gta3_steam(unsigned int address) {
+    return translateAddrRanges(gta3_steam_ranges.mRanges, address);
+}
 
-    // other RW functions
-    if (address >= 0x59E8B0)
-        return 0;
-    if (address >= 0x59CF50)
-        return address - 0x110;
-    if (address >= 0x59BC70)
-        return address - 0x2F10;
-    if (address >= 0x598E70)
-        return address + 0x11D0;
-    if (address >= 0x581FD0)
-        return address - 0x110;
-    if (address >= 0x567240)
-        return address - 0x100;
-    if (address >= 0x5670D0)
-        return address - 0x80;
-    if (address >= 0x53A090)
-        return address - 0x50;
-    if (address >= 0x48AF50)
-        return address - 0x70;
-    if (address >= 0x48AEE0 && address < 0x48AF50)
-        return 0;
+// GTA III Steam -> 1.0: reverse table
+inline constexpr size_t gta3_steam_reverse_count = countInvertedAddrRanges(gta3_steam_ranges.mRanges);
+inline constexpr auto gta3_steam_reverse_ranges = invertAddrRanges<gta3_steam_reverse_count>(gta3_steam_ranges.mRanges);
 
-    return address;
+inline unsigned int untranslate_gta3_steam(unsigned int address) {
+    return translateAddrRanges(gta3_steam_reverse_ranges.mRanges, address);
 }
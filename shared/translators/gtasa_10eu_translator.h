@@ -1,4 +1,5 @@
 #pragma once
+#include "address_ranges.h"
 
 /*
     https://github.com/CookiePLMonster/RawMouse/blob/master/RawMouse/MemoryMgr.h
@@ -6,13 +7,23 @@
 
 */
 
+// GTA SA 1.0 US -> 1.0 EU address ranges
+inline constexpr AddressRange gtasa_10eu_ranges[] = {
+    { 0x000000, 0, false },
+    { 0x000001, 0 },
+    { 0x746720, 0x50 },
+    { 0x7BA940, 0x40 },
+    { 0x857000, 0 },
+};
+
 inline unsigned int translate_gtasa_10eu(unsigned int address) {
-    if (address == 0)
-        return address;
-    if (address >= 0x746720 && address < 0x857000) {
-        if (address >= 0x7BA940)
-            return address + 0x40;
-        return address + 0x50;
-	}
-    return address;
+    return translateAddrRanges(gtasa_10eu_ranges, address);
+}
+
+// GTA SA 1.0 EU -> 1.0 US: reverse table
+inline constexpr size_t gtasa_10eu_reverse_count = countInvertedAddrRanges(gtasa_10eu_ranges);
+inline constexpr auto gtasa_10eu_reverse_ranges = invertAddrRanges<gtasa_10eu_reverse_count>(gtasa_10eu_ranges);
+
+inline unsigned int untranslate_gtasa_10eu(unsigned int address) {
+    return translateAddrRanges(gtasa_10eu_reverse_ranges.mRanges, address);
 }
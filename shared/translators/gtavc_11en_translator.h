@@ -1,112 +1,73 @@
 #pragma once
+#include "address_ranges.h"
 
 /*
     https://github.com/spaceeinstein/gtalc-dinput8/blob/master/vcversion/src/VerAdjust.cpp
 */
 
+// GTA VC 1.0 -> 1.1 address ranges
+inline constexpr AddressRange gtavc_11en_ranges[] = {
+    { 0x000000, 0, false },
+    { 0x000001, 0 },
+    { 0x489D0C, 0x4 },
+    { 0x489D10, 0xD },
+    { 0x489D82, 0xE },
+    { 0x489E0D, 0x10 },
+    { 0x498FF3, 0x21 },
+    { 0x4A4353, 0x20 },
+    { 0x600FB0, 0x30 },
+    { 0x601E83, 0x2E },
+    { 0x601EAB, 0x2C },
+    { 0x601EAD, 0x30 },
+    { 0x601EDC, 0x2E },
+    { 0x601EDE, 0x30 },
+    { 0x601F0E, 0x2E },
+    { 0x601F10, 0x30 },
+    { 0x601F48, 0x2E },
+    { 0x601F50, 0x28 },
+    { 0x601F5F, 0x26 },
+    { 0x601F8C, 0x24 },
+    { 0x601FF9, -0x20 },
+    { 0x626F79, -0x1B },
+    { 0x626F7F, -0x20 },
+    { 0x6271C9, -0x19 },
+    { 0x6271D8, -0x20 },
+    { 0x6271ED, -0x14 },
+    { 0x6271F7, -0x2 },
+    { 0x627203, 0x20 },
+    { 0x62720A, -0x1 },
+    { 0x627214, 0x8 },
+    { 0x62721B, 0xF },
+    { 0x6272DB, 0x10 },
+    { 0x6273D1, 0x23 },
+    { 0x627448, 0x28 },
+    { 0x627470, 0x26 },
+    { 0x6274B6, 0x2A },
+    { 0x6274CC, 0x20 },
+    { 0x627570, 0x46 },
+    { 0x62758D, 0x50 },
+    { 0x67E000, 0 },
+    { 0x6D6688, -0x2C },
+    { 0x6D6B28, -0x28 },
+    { 0x6DB8E8, 0xAB45C },
+    { 0x6DB8E9, -0x28 },
+    { 0x6DB8F0, -0x30 },
+    { 0x6DB924, -0x10 },
+    { 0x6E0000, 0 },
+    { 0x786BA8, 0x4 },
+    { 0x786D40, 0x8 },
+    { 0xA10B56, 0x9 },
+    { 0xA12000, 0 },
+};
+
 inline unsigned int translate_gtavc_11en(unsigned int address) {
-    if (address == 0)
-        return 0;
-    if (address < 0x489D0C)
-        return address;
-    else if (address < 0x489D10)
-        return address + 0x04;
-    else if (address < 0x489D82)
-        return address + 0x0D;
-    else if (address < 0x489E0D)
-        return address + 0x0E;
-    else if (address < 0x498FF3)
-        return address + 0x10;
-    else if (address < 0x4A4353)
-        return address + 0x21;
-    else if (address < 0x600FB0)
-        return address + 0x20;
-    else if (address < 0x601FF9) {
-        if (address < 0x601E83)
-            return address + 0x30;
-        else if (address < 0x601EAB)
-            return address + 0x2E;
-        else if (address < 0x601EAD)
-            return address + 0x2C;
-        else if (address < 0x601EDC)
-            return address + 0x30;
-        else if (address < 0x601EDE)
-            return address + 0x2E;
-        else if (address < 0x601F0E)
-            return address + 0x30;
-        else if (address < 0x601F10)
-            return address + 0x2E;
-        else if (address < 0x601F48)
-            return address + 0x30;
-        else if (address < 0x601F50)
-            return address + 0x2E;
-        else if (address < 0x601F5F)
-            return address + 0x28;
-        else if (address < 0x601F8C)
-            return address + 0x26;
-        else
-            return address + 0x24;
-    }
-    else if (address < 0x626F79)
-        return address - 0x20;
-    else if (address < 0x62758D) {
-        if (address < 0x626F7F)
-            return address - 0x1B;
-        else if (address < 0x6271C9)
-            return address - 0x20;
-        else if (address < 0x6271D8)
-            return address - 0x19;
-        else if (address < 0x6271ED)
-            return address - 0x20;
-        else if (address < 0x6271F7)
-            return address - 0x14;
-        else if (address < 0x627203)
-            return address - 0x02;
-        else if (address < 0x62720A)
-            return address + 0x20;
-        else if (address < 0x627214)
-            return address - 0x01;
-        else if (address < 0x62721B)
-            return address + 0x08;
-        else if (address < 0x6272DB)
-            return address + 0x0F;
-        else if (address < 0x6273D1)
-            return address + 0x10;
-        else if (address < 0x627448)
-            return address + 0x23;
-        else if (address < 0x627470)
-            return address + 0x28;
-        else if (address < 0x6274B6)
-            return address + 0x26;
-        else if (address < 0x6274CC)
-            return address + 0x2A;
-        else if (address < 0x627570)
-            return address + 0x20;
-        else
-            return address + 0x46;
-    }
-    else if (address < 0x67E000)
-        return address + 0x50;
-    else if (address < 0x6D6688)
-        return address;
-    else if (address < 0x6D6B28)
-        return address - 0x2C;
-    else if (address == 0x6DB8E8)
-        return 0x786D44;
-    else if (address < 0x6DB8F0)
-        return address - 0x28;
-    else if (address < 0x6DB924)
-        return address - 0x30;
-    else if (address < 0x6E0000)
-        return address - 0x10;
-    else if (address < 0x786BA8)
-        return address;
-    else if (address < 0x786D40)
-        return address + 0x04;
-    else if (address < 0xA10B56)
-        return address + 0x08;
-    else if (address < 0xA12000)
-        return address + 0x09;
-    else
-        return address;
+    return translateAddrRanges(gtavc_11en_ranges, address);
+}
+
+// GTA VC 1.1 -> 1.0: reverse table
+inline constexpr size_t gtavc_11en_reverse_count = countInvertedAddrRanges(gtavc_11en_ranges);
+inline constexpr auto gtavc_11en_reverse_ranges = invertAddrRanges<gtavc_11en_reverse_count>(gtavc_11en_ranges);
+
+inline unsigned int untranslate_gtavc_11en(unsigned int address) {
+    return translateAddrRanges(gtavc_11en_reverse_ranges.mRanges, address);
 }
@@ -1,150 +1,91 @@
 #pragma once
+#include "address_ranges.h"
 
 /*
     https://github.com/spaceeinstein/gtalc-dinput8/blob/master/vcversion/src/VerAdjust.cpp
 */
 
+// GTA VC 1.0 -> Steam address ranges
+inline constexpr AddressRange gtavc_steam_ranges[] = {
+    { 0x000000, 0, false },
+    { 0x000001, 0 },
+    { 0x41CC07, -0x37 },
+    { 0x41CC20, -0x30 },
+    { 0x434730, -0x40 },
+    { 0x435029, -0x83 },
+    { 0x435040, -0x90 },
+    { 0x443E00, -0xF0 },
+    { 0x4518D3, -0x124 },
+    { 0x4518E0, -0x120 },
+    { 0x489D10, -0x113 },
+    { 0x489D82, -0x112 },
+    { 0x489E10, -0x110 },
+    { 0x48E6FD, -0x10E },
+    { 0x48E830, -0xF2 },
+    { 0x48EC30, -0xF0 },
+    { 0x498FF3, -0xDF },
+    { 0x49B993, -0xF6 },
+    { 0x49BB91, -0x131 },
+    { 0x49BD00, -0x141 },
+    { 0x4A4360, -0x140 },
+    { 0x4A448A, -0x18D },
+    { 0x4A4586, -0x186 },
+    { 0x4A4670, -0x180 },
+    { 0x4A4734, -0x144 },
+    { 0x4A47B0, -0x140 },
+    { 0x4A4BE3, -0x139 },
+    { 0x4A4CF3, -0x133 },
+    { 0x4A4FD0, -0x130 },
+    { 0x4C4230, -0x140 },
+    { 0x516F87, -0x111 },
+    { 0x517060, -0x110 },
+    { 0x57BF40, -0x1D0 },
+    { 0x5CC921, -0x225 },
+    { 0x5CC9E0, -0x230 },
+    { 0x5D7270, -0x2D0 },
+    { 0x5D7A12, -0x3A2 },
+    { 0x5D7A40, -0x3A0 },
+    { 0x600FB0, -0x390 },
+    { 0x602000, -0x3E0 },
+    { 0x61D3D0, -0x3C0 },
+    { 0x62121B, -0x3AF },
+    { 0x621230, -0x3B0 },
+    { 0x62721B, -0x381 },
+    { 0x6272E0, -0x380 },
+    { 0x6274D0, -0x370 },
+    { 0x627570, -0x34A },
+    { 0x627590, -0x340 },
+    { 0x63762B, -0x341 },
+    { 0x639268, -0x1050 },
+    { 0x67E000, -0x1000 },
+    { 0x68DD7C, -0xFF8 },
+    { 0x69A020, -0x1004 },
+    { 0x69A0C8, -0x1000 },
+    { 0x6A5580, -0x1004 },
+    { 0x6A5740, -0x1008 },
+    { 0x6D668C, -0x1034 },
+    { 0x6D6B28, -0x1030 },
+    { 0x6DB8F0, -0x1038 },
+    { 0x6DB924, -0x1018 },
+    { 0x6DCAE0, -0x1068 },
+    { 0x6F23C0, -0x1008 },
+    { 0x6F2434, -0x100C },
+    { 0x6F245C, -0x1010 },
+    { 0x6F7000, -0x1000 },
+    { 0x786BA8, -0xFFC },
+    { 0x786D40, -0xFF8 },
+    { 0xA10B20, -0xFF7 },
+    { 0xA10B4E, -0xFF6 },
+};
+
 inline unsigned int translate_gtavc_steam(unsigned int address) {
-    if (address == 0)
-        return 0;
-    if (address < 0x41CC07)
-        return address - 0x0;
-    else if (address < 0x41CC20)
-        return address - 0x37;
-    else if (address < 0x434730)
-        return address - 0x30;
-    else if (address < 0x435029)
-        return address - 0x40;
-    else if (address < 0x435040)
-        return address - 0x83;
-    else if (address < 0x443E00)
-        return address - 0x90;
-    else if (address < 0x4518D3)
-        return address - 0xF0;
-    else if (address < 0x4518E0)
-        return address - 0x124;
-    else if (address < 0x489D10)
-        return address - 0x120;
-    else if (address < 0x489D82)
-        return address - 0x113;
-    else if (address < 0x489E10)
-        return address - 0x112;
-    else if (address < 0x48E6FD)
-        return address - 0x110;
-    else if (address < 0x48E830)
-        return address - 0x10E;
-    else if (address < 0x48EC30)
-        return address - 0xF2;
-    else if (address < 0x498FF3)
-        return address - 0xF0;
-    else if (address < 0x49B993)
-        return address - 0xDF;
-    else if (address < 0x49BB91)
-        return address - 0xF6;
-    else if (address < 0x49BD00)
-        return address - 0x131;
-    else if (address < 0x4A4360)
-        return address - 0x141;
-    else if (address < 0x4A448A)
-        return address - 0x140;
-    else if (address < 0x4A4586)
-        return address - 0x18D;
-    else if (address < 0x4A4670)
-        return address - 0x186;
-    else if (address < 0x4A4734)
-        return address - 0x180;
-    else if (address < 0x4A47B0)
-        return address - 0x144;
-    else if (address < 0x4A4BE3)
-        return address - 0x140;
-    else if (address < 0x4A4CF3)
-        return address - 0x139;
-    else if (address < 0x4A4FD0)
-        return address - 0x133;
-    else if (address < 0x4C4230)
-        return address - 0x130;
-    else if (address < 0x516F87)
-        return address - 0x140;
-    else if (address < 0x517060)
-        return address - 0x111;
-    else if (address < 0x57BF40)
-        return address - 0x110;
-    else if (address < 0x5CC921)
-        return address - 0x1D0;
-    else if (address < 0x5CC9E0)
-        return address - 0x225;
-    else if (address < 0x5D7270)
-        return address - 0x230;
-    else if (address < 0x5D7A12)
-        return address - 0x2D0;
-    else if (address < 0x5D7A40)
-        return address - 0x3A2;
-    else if (address < 0x600FB0)
-        return address - 0x3A0;
-    else if (address < 0x602000)
-        return address - 0x390;
-    else if (address < 0x61D3D0)
-        return address - 0x3E0;
-    else if (address < 0x62121B)
-        return address - 0x3C0;
-    else if (address < 0x621230)
-        return address - 0x3AF;
-    else if (address < 0x626F80)
-        return address - 0x3B0;
-    else if (address < 0x62721B)
-        return address - 0x3B0;
-    else if (address < 0x6272E0)
-        return address - 0x381;
-    else if (address < 0x6274D0)
-        return address - 0x380;
-    else if (address < 0x627570)
-        return address - 0x370;
-    else if (address < 0x627590)
-        return address - 0x34A;
-    else if (address < 0x63762B)
-        return address - 0x340;
-    else if (address < 0x639268)
-        return address - 0x341;
-    else if (address < 0x67E000)
-        return address - 0x1050;
-    else if (address < 0x683000)
-        return address - 0x1000;
-    else if (address < 0x68DD7C)
-        return address - 0x1000;
-    else if (address < 0x69A020)
-        return address - 0xFF8;
-    else if (address < 0x69A0C8)
-        return address - 0x1004;
-    else if (address < 0x6A5580)
-        return address - 0x1000;
-    else if (address < 0x6A5740)
-        return address - 0x1004;
-    else if (address < 0x6D668C)
-        return address - 0x1008;
-    else if (address < 0x6D6B28)
-        return address - 0x1034;
-    else if (address < 0x6DB8F0)
-        return address - 0x1030;
-    else if (address < 0x6DB924)
-        return address - 0x1038;
-    else if (address < 0x6DCAE0)
-        return address - 0x1018;
-    else if (address < 0x6F23C0)
-        return address - 0x1068;
-    else if (address < 0x6F2434)
-        return address - 0x1008;
-    else if (address < 0x6F245C)
-        return address - 0x100C;
-    else if (address < 0x6F7000)
-        return address - 0x1010;
-    else if (address < 0x786BA8)
-        return address - 0x1000;
-    else if (address < 0x786D40)
-        return address - 0xFFC;
-    else if (address < 0xA10B20)
-        return address - 0xFF8;
-    else if (address < 0xA10B4E)
-        return address - 0xFF7;
-    else
-        return address - 0xFF6;
+    return translateAddrRanges(gtavc_steam_ranges, address);
+}
+
+// GTA VC Steam -> 1.0: reverse table
+inline constexpr size_t gtavc_steam_reverse_count = countInvertedAddrRanges(gtavc_steam_ranges);
+inline constexpr auto gtavc_steam_reverse_ranges = invertAddrRanges<gtavc_steam_reverse_count>(gtavc_steam_ranges);
+
+inline unsigned int untranslate_gtavc_steam(unsigned int address) {
+    return translateAddrRanges(gtavc_steam_reverse_ranges.mRanges, address);
 }
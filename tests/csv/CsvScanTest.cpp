@@ -0,0 +1,219 @@
+// Differential test of CSV readers which use CsvScan (shared\CsvScan.h): CSV::NextField/CSV::Read
+// (plugin-sdk-source-gen) and readcsvparameter (PluginSdkLib) are compared with the character-by-character
+// readers they replaced, on quoting edge cases and random lines. Built and run by tests/csv_scan_test.py
+// with scalar, SSE2 and AVX2 search (AVX2 is selected at run time, as in the tools).
+#include "../../plugin-sdk-source-gen/CSV.h"
+#include "../../PluginSdkIdaTools/PluginSdkLib/ut_string.h"
+#include <iostream>
+#include <random>
+
+using namespace std;
+
+static const char *ScanMode = CsvScan::Mode();
+
+// CSV::NextField before CsvScan
+string_view ReferenceNextField(string_view line, size_t &currIndex, string &buffer) {
+    size_t start = currIndex;
+    while (currIndex < line.length()) {
+        auto c = line[currIndex];
+        if (c == '"')
+            break;
+        if (c == '\r' || c == '\n') {
+            auto result = line.substr(start, currIndex - start);
+            currIndex = line.length();
+            return String::Trim(result);
+        }
+        if (c == ',') {
+            auto result = line.substr(start, currIndex - start);
+            currIndex++;
+            return String::Trim(result);
+        }
+        currIndex++;
+    }
+    if (currIndex == line.length())
+        return String::Trim(line.substr(start));
+    buffer.assign(line.data() + start, currIndex - start);
+    bool startedQuotes = false;
+    bool inQuotes = false;
+    while (currIndex < line.length()) {
+        auto c = line[currIndex];
+        if (c == '\r' || c == '\n') {
+            currIndex = line.length();
+            break;
+        }
+        if (!startedQuotes) {
+            if (c == '"')
+                startedQuotes = true;
+            else if (!inQuotes && c == ',') {
+                currIndex++;
+                break;
+            }
+            else
+                buffer += c;
+        }
+        else {
+            if (c != '"') {
+                inQuotes = !inQuotes;
+                if (!inQuotes && c == ',') {
+                    currIndex++;
+                    break;
+                }
+            }
+            startedQuotes = false;
+            buffer += c;
+        }
+        currIndex++;
+    }
+    return String::Trim(string_view(buffer));
+}
+
+// readcsvparameter before CsvScan
+void ReferenceReadCsvParameter(qstring const &line, unsigned int &currIndex, qstring &param) {
+    qstring tmp;
+    bool startedQuotes = false;
+    bool inQuotes = false;
+    while (currIndex < line.length()) {
+        auto c = line[currIndex];
+        if (c == '\r' || c == '\n') {
+            currIndex = line.length();
+            break;
+        }
+        if (!startedQuotes) {
+            if (c == '"')
+                startedQuotes = true;
+            else if (!inQuotes && c == ',') {
+                currIndex++;
+                break;
+            }
+            else
+                tmp.append(c);
+        }
+        else {
+            if (c != '"') {
+                inQuotes = !inQuotes;
+                if (!inQuotes && c == ',') {
+                    currIndex++;
+                    break;
+                }
+            }
+            startedQuotes = false;
+            tmp.append(c);
+        }
+        currIndex++;
+    }
+    param = tmp;
+    param.trim2(' ');
+}
+
+string Escape(string_view str) {
+    string result;
+    for (char c : str) {
+        if (c == '\r')
+            result += "\\r";
+        else if (c == '\n')
+            result += "\\n";
+        else
+            result += c;
+    }
+    return result;
+}
+
+bool Fail(string_view line, string const &what, string_view expected, string_view actual) {
+    cout << "FAILED (" << ScanMode << "): " << what << endl;
+    cout << "    line:     '" << Escape(line) << "'" << endl;
+    cout << "    expected: '" << Escape(expected) << "'" << endl;
+    cout << "    actual:   '" << Escape(actual) << "'" << endl;
+    return false;
+}
+
+const unsigned int NumFieldsToRead = 6; // more than fields in most test lines - empty fields at the end are read too
+unsigned long long gNumFields = 0;
+
+bool CheckLine(string_view line) {
+    // CSV::NextField
+    size_t index = 0, refIndex = 0;
+    string buffer, refBuffer;
+    for (unsigned int i = 0; i < NumFieldsToRead; i++) {
+        string field(CSV::NextField(line, index, buffer));
+        string refField(ReferenceNextField(line, refIndex, refBuffer));
+        if (field != refField)
+            return Fail(line, "NextField() field " + to_string(i), refField, field);
+        if (index != refIndex)
+            return Fail(line, "NextField() position after field " + to_string(i), to_string(refIndex), to_string(index));
+        gNumFields++;
+    }
+    // CSV::Read
+    string f[NumFieldsToRead];
+    CSV::Read(line, f[0], f[1], f[2], f[3], f[4], f[5]);
+    refIndex = 0;
+    for (unsigned int i = 0; i < NumFieldsToRead; i++) {
+        string refField(ReferenceNextField(line, refIndex, refBuffer));
+        if (f[i] != refField)
+            return Fail(line, "Read() field " + to_string(i), refField, f[i]);
+    }
+    // readcsvparameter
+    qstring qline(string(line.data(), line.length()));
+    unsigned int qindex = 0, qrefIndex = 0;
+    for (unsigned int i = 0; i < NumFieldsToRead; i++) {
+        qstring field, refField;
+        readcsvparameter(qline, qindex, field);
+        ReferenceReadCsvParameter(qline, qrefIndex, refField);
+        if (field.str() != refField.str())
+            return Fail(line, "readcsvparameter() field " + to_string(i), refField.str(), field.str());
+        if (qindex != qrefIndex)
+            return Fail(line, "readcsvparameter() position after field " + to_string(i), to_string(qrefIndex), to_string(qindex));
+        gNumFields++;
+    }
+    return true;
+}
+
+// random line from quotes, commas, line breaks, spaces and plain characters; plain runs cross 16- and 32-byte blocks
+string RandomLine(mt19937 &rng) {
+    static const char specials[] = { '"', '"', '"', ',', ',', ',', ' ', ' ', '\r', '\n' };
+    string line;
+    unsigned int numParts = rng() % 12;
+    for (unsigned int i = 0; i < numParts; i++) {
+        if (rng() % 3 == 0) {
+            unsigned int runLength = rng() % 70;
+            for (unsigned int j = 0; j < runLength; j++)
+                line += static_cast<char>('a' + rng() % 26);
+        }
+        else {
+            unsigned int numSpecials = 1 + rng() % 4;
+            for (unsigned int j = 0; j < numSpecials; j++)
+                line += specials[rng() % sizeof(specials)];
+        }
+    }
+    return line;
+}
+
+int main(int argc, char *argv[]) {
+    unsigned int numRandomLines = argc > 1 ? static_cast<unsigned int>(atoi(argv[1])) : 1000000;
+    const char *edgeCases[] = {
+        "", ",", ",,", " , ", "\"", "\"\"", "\"\"\"", "\"\"\"\"", "a\"", "\"a", "a\"\"b", "\"a,b\",c", "\"a\"\"b\",c",
+        "\"\"\"a\"\"\",b", "\"a\"b,c", "a\"b\"c,d", "\"a,b", "\"a\r\nb\",c", "a\rb,c", "a\nb", "\r", "\n", "\r\n,a",
+        " a , b , c ", "\" a \", b", "\",\",\",\"", "a,\"\",b", "\"a\"\",\"\"b\"", "a, \"b,c\" ,d",
+        "0x401000,Module,?name@@YAXXZ,name,,cdecl,void,,0,,\"comment, with comma\",1,-1,0",
+        "0x401000,Module,name,\"CVector::operator=(CVector const&)\",,thiscall,\"CVector &\",\"CVector *:this CVector const &:right\"",
+    };
+    for (auto line : edgeCases) {
+        if (!CheckLine(line))
+            return 1;
+    }
+    // quotes and commas at block boundaries (plain runs of 14..34 characters)
+    for (unsigned int runLength = 14; runLength <= 34; runLength++) {
+        string run(runLength, 'x');
+        const char *suffixes[] = { ",", "\"", "\r", "\n", "\",\"", "\"\"", " ,", "" };
+        for (auto suffix : suffixes) {
+            if (!CheckLine(run + suffix + run) || !CheckLine("\"" + run + suffix + run + "\"," + run) || !CheckLine(run + "\"" + suffix))
+                return 1;
+        }
+    }
+    mt19937 rng(12345);
+    for (unsigned int i = 0; i < numRandomLines; i++) {
+        if (!CheckLine(RandomLine(rng)))
+            return 1;
+    }
+    cout << "OK (" << ScanMode << "): " << numRandomLines << " random lines, " << gNumFields << " fields same as reference" << endl;
+    return 0;
+}
@@ -0,0 +1,28 @@
+#pragma once
+#include <string>
+#include <cstddef>
+
+// Minimal stand-in for IDA SDK qstring, enough for readcsvparameter() in PluginSdkLib\ut_string.h
+class qstring {
+    std::string mStr;
+public:
+    qstring() {}
+    qstring(char const *str) : mStr(str) {}
+    qstring(std::string const &str) : mStr(str) {}
+
+    size_t length() const { return mStr.length(); }
+    char const *c_str() const { return mStr.c_str(); }
+    char operator[](size_t index) const { return mStr[index]; }
+    qstring &append(char c) { mStr += c; return *this; }
+    qstring &append(char const *str, size_t length) { mStr.append(str, length); return *this; }
+    // remove leading and trailing 'c' characters
+    qstring &trim2(char c) {
+        size_t first = mStr.find_first_not_of(c);
+        if (first == std::string::npos)
+            mStr.clear();
+        else
+            mStr = mStr.substr(first, mStr.find_last_not_of(c) - first + 1);
+        return *this;
+    }
+    std::string const &str() const { return mStr; }
+};
@@ -0,0 +1,82 @@
+"""Builds and runs the CSV reader differential test (tests/csv/CsvScanTest.cpp).
+
+usage:
+    python tests/csv_scan_test.py [compiler [extra compiler options...]]
+
+The test compares CSV::NextField/CSV::Read (plugin-sdk-source-gen) and readcsvparameter (PluginSdkLib)
+with the character-by-character readers they replaced. It is built once for each search mode of
+shared/CsvScan.h (BUILDS): scalar, SSE2 and AVX2. The AVX2 build uses no AVX2 compiler options: like the tools,
+it selects AVX2 search at run time, so it needs a CPU with AVX2. The compiler is 'cl' on Windows (run from a Visual Studio
+developer command prompt) and 'g++' on other systems; other gcc-compatible compilers (clang++) take the same
+options. The sources included by the test use forward-slash includes, and MappedFile.h uses std::filesystem
+instead of std::experimental::filesystem when it is not built with cl, so the test also builds with g++ on Linux.
+tests/csv/ida contains a minimal qstring, so the IDA SDK is not needed.
+"""
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+TESTS_DIR = os.path.dirname(os.path.abspath(__file__))
+ROOT_DIR = os.path.dirname(TESTS_DIR)
+SOURCES = [
+    os.path.join(TESTS_DIR, 'csv', 'CsvScanTest.cpp'),
+    os.path.join(ROOT_DIR, 'plugin-sdk-source-gen', 'CSV.cpp'),
+    os.path.join(ROOT_DIR, 'plugin-sdk-source-gen', 'StringEx.cpp'),
+    os.path.join(ROOT_DIR, 'plugin-sdk-source-gen', 'MappedFile.cpp'),
+]
+STUB_INCLUDE_DIR = os.path.join(TESTS_DIR, 'csv', 'ida')
+
+# name, search mode printed by the test, options for cl, options for gcc/clang
+BUILDS = [
+    ('scalar', 'scalar', ['/DCSVSCAN_SCALAR'], ['-DCSVSCAN_SCALAR']),
+    ('SSE2', 'SSE2', ['/DCSVSCAN_NO_AVX2'], ['-msse2', '-DCSVSCAN_NO_AVX2']),
+    ('AVX2', 'AVX2', [], []),
+]
+
+
+def build(compiler, extra, options, output):
+    if os.path.basename(compiler).lower().startswith('cl'):
+        command = [compiler, '/nologo', '/std:c++17', '/O2', '/EHsc', '/I' + STUB_INCLUDE_DIR] + options + extra + SOURCES + \
+            ['/Fe' + output, '/Fo' + os.path.dirname(output) + os.sep]
+    else:
+        command = [compiler, '-std=c++17', '-O2', '-I' + STUB_INCLUDE_DIR] + options + SOURCES + ['-o', output] + extra
+    result = subprocess.run(command, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True)
+    return result.returncode, result.stdout
+
+
+def main():
+    compiler = sys.argv[1] if len(sys.argv) > 1 else ('cl' if os.name == 'nt' else 'g++')
+    extra = sys.argv[2:]
+    isCl = os.path.basename(compiler).lower().startswith('cl')
+    root = tempfile.mkdtemp(prefix='csv-scan-test-')
+    try:
+        numFailed = 0
+        for name, mode, clOptions, gccOptions in BUILDS:
+            folder = os.path.join(root, name)
+            os.makedirs(folder)
+            output = os.path.join(folder, 'CsvScanTest.exe')
+            code, log = build(compiler, extra, clOptions if isCl else gccOptions, output)
+            if code != 0:
+                print(log)
+                print('FAILED: %s (build)' % name)
+                numFailed += 1
+                continue
+            result = subprocess.run([output], stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True)
+            print(result.stdout.rstrip())
+            if result.returncode != 0:
+                print('FAILED: %s (exited with %d)' % (name, result.returncode))
+                numFailed += 1
+            elif '(%s)' % mode not in result.stdout:
+                # for example, the CPU doesn't support AVX2
+                print('FAILED: %s (test was built with other search mode)' % name)
+                numFailed += 1
+    finally:
+        shutil.rmtree(root, ignore_errors=True)
+    print('%d of %d builds failed' % (numFailed, len(BUILDS)) if numFailed else 'All %d builds passed' % len(BUILDS))
+    return 1 if numFailed else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,83 @@
+/*
+    Plugin-SDK (Grand Theft Auto 3) source file
+    Authors: GTA Community. See more here
+    https://github.com/DK22Pac/plugin-sdk
+    Do not delete this comment block. Respect others' work!
+*/
+#include "C0.h"
+
+PLUGIN_SOURCE_FILE
+
+PLUGIN_VARIABLE C0 *&C0::Inner::ms_x = *reinterpret_cast<C0 **>(GLOBAL_ADDRESS_BY_VERSION(0xB00008, 0xB0000C, 0xB00010));
+PLUGIN_VARIABLE int &C0::ms_count = *reinterpret_cast<int *>(GLOBAL_ADDRESS_BY_VERSION(0xB00000, 0xB00004, 0xB00008));
+PLUGIN_VARIABLE float const(&g_array0)[4] = *reinterpret_cast<float const(*)[4]>(GLOBAL_ADDRESS_BY_VERSION(0xB00004, 0xB00008, 0xB0000C));
+
+int ctor_addr(C0) = ADDRESS_BY_VERSION(0x401030, 0x401040, 0x401050);
+int ctor_gaddr(C0) = GLOBAL_ADDRESS_BY_VERSION(0x401030, 0x401040, 0x401050);
+
+int ctor_addr_o(C0, void(int, float)) = ADDRESS_BY_VERSION(0x401060, 0x401070, 0x401080);
+int ctor_gaddr_o(C0, void(int, float)) = GLOBAL_ADDRESS_BY_VERSION(0x401060, 0x401070, 0x401080);
+
+int dtor_addr(C0) = ADDRESS_BY_VERSION(0x401090, 0x4010A0, 0x4010B0);
+int dtor_gaddr(C0) = GLOBAL_ADDRESS_BY_VERSION(0x401090, 0x4010A0, 0x4010B0);
+
+int op_new_addr(C0) = ADDRESS_BY_VERSION(0x401210, 0x401220, 0x401230);
+int op_new_gaddr(C0) = GLOBAL_ADDRESS_BY_VERSION(0x401210, 0x401220, 0x401230);
+
+int addrof(C0::operator==) = ADDRESS_BY_VERSION(0x4011E0, 0x4011F0, 0x401200);
+int gaddrof(C0::operator==) = GLOBAL_ADDRESS_BY_VERSION(0x4011E0, 0x4011F0, 0x401200);
+
+bool C0::operator==(C0 &other) {
+    return plugin::CallMethodAndReturnDynGlobal<bool, C0 *, C0 &>(gaddrof(C0::operator==), this, other);
+}
+
+int addrof(C0::Process) = ADDRESS_BY_VERSION(0x4010C0, 0, 0);
+int gaddrof(C0::Process) = GLOBAL_ADDRESS_BY_VERSION(0x4010C0, 0, 0);
+
+void C0::Process() {
+    plugin::CallVirtualMethod<1, C0 *>(this);
+}
+
+int addrof(C0::Render) = ADDRESS_BY_VERSION(0x4010F0, 0x401100, 0x401110);
+int gaddrof(C0::Render) = GLOBAL_ADDRESS_BY_VERSION(0x4010F0, 0x401100, 0x401110);
+
+bool C0::Render(int mode) {
+    return plugin::CallVirtualMethodAndReturn<bool, 2, C0 *, int>(this, mode);
+}
+
+int addrof(C0::GetPos) = ADDRESS_BY_VERSION(0x401120, 0x401130, 0x401140);
+int gaddrof(C0::GetPos) = GLOBAL_ADDRESS_BY_VERSION(0x401120, 0x401130, 0x401140);
+
+CVector C0::GetPos() {
+    CVector ret_out;
+    plugin::CallMethodDynGlobal<C0 *, CVector *>(gaddrof(C0::GetPos), this, &ret_out);
+    return ret_out;
+}
+
+int addrof(C0::SetName) = ADDRESS_BY_VERSION(0x401150, 0x401160, 0x401170);
+int gaddrof(C0::SetName) = GLOBAL_ADDRESS_BY_VERSION(0x401150, 0x401160, 0x401170);
+
+void C0::SetName(wchar_t *name) {
+    plugin::CallMethodDynGlobal<C0 *, wchar_t *>(gaddrof(C0::SetName), this, name);
+}
+
+int addrof_o(C0::Update, int (*)(float)) = ADDRESS_BY_VERSION(0x401180, 0x401190, 0x4011A0);
+int gaddrof_o(C0::Update, int (*)(float)) = GLOBAL_ADDRESS_BY_VERSION(0x401180, 0x401190, 0x4011A0);
+
+int C0::Update(float dt) {
+    return plugin::CallAndReturnDynGlobal<int, float>(gaddrof_o(C0::Update, int (*)(float)), dt);
+}
+
+int addrof_o(C0::Update, int (*)(float, int)) = ADDRESS_BY_VERSION(0x4011B0, 0, 0);
+int gaddrof_o(C0::Update, int (*)(float, int)) = GLOBAL_ADDRESS_BY_VERSION(0x4011B0, 0, 0);
+
+int C0::Update(float dt, int x) {
+    return plugin::CallAndReturnDynGlobal<int, float, int>(gaddrof_o(C0::Update, int (*)(float, int)), dt, x);
+}
+
+int addrof(GlobalFunc0) = ADDRESS_BY_VERSION(0x401240, 0x401250, 0x401260);
+int gaddrof(GlobalFunc0) = GLOBAL_ADDRESS_BY_VERSION(0x401240, 0x401250, 0x401260);
+
+void GlobalFunc0(char const *fmt, ... arg2) {
+    plugin::CallDynGlobal<char const *, ...>(gaddrof(GlobalFunc0), fmt, arg2);
+}
@@ -0,0 +1,80 @@
+/*
+    Plugin-SDK (Grand Theft Auto 3) source file
+    Authors: GTA Community. See more here
+    https://github.com/DK22Pac/plugin-sdk
+    Do not delete this comment block. Respect others' work!
+*/
+#include "C3.h"
+
+PLUGIN_SOURCE_FILE
+
+PLUGIN_VARIABLE C3 *&C3::Inner::ms_x = *reinterpret_cast<C3 **>(GLOBAL_ADDRESS_BY_VERSION(0xB00038, 0xB0003C, 0xB00040));
+PLUGIN_VARIABLE int &C3::ms_count = *reinterpret_cast<int *>(GLOBAL_ADDRESS_BY_VERSION(0xB00030, 0xB00034, 0xB00038));
+PLUGIN_VARIABLE float const(&g_array3)[4] = *reinterpret_cast<float const(*)[4]>(GLOBAL_ADDRESS_BY_VERSION(0xB00034, 0xB00038, 0xB0003C));
+
+int ctor_addr(C3) = ADDRESS_BY_VERSION(0x404030, 0x404040, 0x404050);
+int ctor_gaddr(C3) = GLOBAL_ADDRESS_BY_VERSION(0x404030, 0x404040, 0x404050);
+
+int dtor_addr(C3) = ADDRESS_BY_VERSION(0x404060, 0x404070, 0x404080);
+int dtor_gaddr(C3) = GLOBAL_ADDRESS_BY_VERSION(0x404060, 0x404070, 0x404080);
+
+int op_new_addr(C3) = ADDRESS_BY_VERSION(0x4041E0, 0x4041F0, 0x404200);
+int op_new_gaddr(C3) = GLOBAL_ADDRESS_BY_VERSION(0x4041E0, 0x4041F0, 0x404200);
+
+int addrof(C3::operator==) = ADDRESS_BY_VERSION(0x4041B0, 0x4041C0, 0x4041D0);
+int gaddrof(C3::operator==) = GLOBAL_ADDRESS_BY_VERSION(0x4041B0, 0x4041C0, 0x4041D0);
+
+bool C3::operator==(C3 &other) {
+    return plugin::CallMethodAndReturnDynGlobal<bool, C3 *, C3 &>(gaddrof(C3::operator==), this, other);
+}
+
+int addrof(C3::Process) = ADDRESS_BY_VERSION(0x404090, 0, 0);
+int gaddrof(C3::Process) = GLOBAL_ADDRESS_BY_VERSION(0x404090, 0, 0);
+
+void C3::Process() {
+    plugin::CallVirtualMethod<1, C3 *>(this);
+}
+
+int addrof(C3::Render) = ADDRESS_BY_VERSION(0x4040C0, 0x4040D0, 0x4040E0);
+int gaddrof(C3::Render) = GLOBAL_ADDRESS_BY_VERSION(0x4040C0, 0x4040D0, 0x4040E0);
+
+bool C3::Render(int mode) {
+    return plugin::CallVirtualMethodAndReturn<bool, 2, C3 *, int>(this, mode);
+}
+
+int addrof(C3::GetPos) = ADDRESS_BY_VERSION(0x4040F0, 0x404100, 0x404110);
+int gaddrof(C3::GetPos) = GLOBAL_ADDRESS_BY_VERSION(0x4040F0, 0x404100, 0x404110);
+
+CVector C3::GetPos() {
+    CVector ret_out;
+    plugin::CallMethodDynGlobal<C3 *, CVector *>(gaddrof(C3::GetPos), this, &ret_out);
+    return ret_out;
+}
+
+int addrof(C3::SetName) = ADDRESS_BY_VERSION(0x404120, 0x404130, 0x404140);
+int gaddrof(C3::SetName) = GLOBAL_ADDRESS_BY_VERSION(0x404120, 0x404130, 0x404140);
+
+void C3::SetName(wchar_t *name) {
+    plugin::CallMethodDynGlobal<C3 *, wchar_t *>(gaddrof(C3::SetName), this, name);
+}
+
+int addrof_o(C3::Update, int (*)(float)) = ADDRESS_BY_VERSION(0x404150, 0x404160, 0x404170);
+int gaddrof_o(C3::Update, int (*)(float)) = GLOBAL_ADDRESS_BY_VERSION(0x404150, 0x404160, 0x404170);
+
+int C3::Update(float dt) {
+    return plugin::CallAndReturnDynGlobal<int, float>(gaddrof_o(C3::Update, int (*)(float)), dt);
+}
+
+int addrof_o(C3::Update, int (*)(float, int)) = ADDRESS_BY_VERSION(0x404180, 0, 0);
+int gaddrof_o(C3::Update, int (*)(float, int)) = GLOBAL_ADDRESS_BY_VERSION(0x404180, 0, 0);
+
+int C3::Update(float dt, int x) {
+    return plugin::CallAndReturnDynGlobal<int, float, int>(gaddrof_o(C3::Update, int (*)(float, int)), dt, x);
+}
+
+int addrof(GlobalFunc3) = ADDRESS_BY_VERSION(0x404210, 0x404220, 0x404230);
+int gaddrof(GlobalFunc3) = GLOBAL_ADDRESS_BY_VERSION(0x404210, 0x404220, 0x404230);
+
+void GlobalFunc3(char const *fmt, ... arg2) {
+    plugin::CallDynGlobal<char const *, ...>(gaddrof(GlobalFunc3), fmt, arg2);
+}
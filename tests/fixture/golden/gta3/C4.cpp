@@ -0,0 +1,66 @@
+/*
+    Plugin-SDK (Grand Theft Auto 3) source file
+    Authors: GTA Community. See more here
+    https://github.com/DK22Pac/plugin-sdk
+    Do not delete this comment block. Respect others' work!
+*/
+#include "C4.h"
+
+PLUGIN_SOURCE_FILE
+
+PLUGIN_VARIABLE C4 *&C4::Inner::ms_x = *reinterpret_cast<C4 **>(GLOBAL_ADDRESS_BY_VERSION(0xB00048, 0xB0004C, 0xB00050));
+PLUGIN_VARIABLE int &C4::ms_count = *reinterpret_cast<int *>(GLOBAL_ADDRESS_BY_VERSION(0xB00040, 0xB00044, 0xB00048));
+PLUGIN_VARIABLE float const(&g_array4)[4] = *reinterpret_cast<float const(*)[4]>(GLOBAL_ADDRESS_BY_VERSION(0xB00044, 0xB00048, 0xB0004C));
+
+int ctor_addr(C4) = ADDRESS_BY_VERSION(0x405030, 0x405040, 0x405050);
+int ctor_gaddr(C4) = GLOBAL_ADDRESS_BY_VERSION(0x405030, 0x405040, 0x405050);
+
+int ctor_addr_o(C4, void(int, float)) = ADDRESS_BY_VERSION(0x405060, 0, 0);
+int ctor_gaddr_o(C4, void(int, float)) = GLOBAL_ADDRESS_BY_VERSION(0x405060, 0, 0);
+
+int op_new_addr(C4) = ADDRESS_BY_VERSION(0x405180, 0x405190, 0x4051A0);
+int op_new_gaddr(C4) = GLOBAL_ADDRESS_BY_VERSION(0x405180, 0x405190, 0x4051A0);
+
+int addrof(C4::operator==) = ADDRESS_BY_VERSION(0x405150, 0, 0);
+int gaddrof(C4::operator==) = GLOBAL_ADDRESS_BY_VERSION(0x405150, 0, 0);
+
+bool C4::operator==(C4 &other) {
+    return plugin::CallMethodAndReturnDynGlobal<bool, C4 *, C4 &>(gaddrof(C4::operator==), this, other);
+}
+
+int addrof(C4::GetPos) = ADDRESS_BY_VERSION(0x405090, 0x4050A0, 0x4050B0);
+int gaddrof(C4::GetPos) = GLOBAL_ADDRESS_BY_VERSION(0x405090, 0x4050A0, 0x4050B0);
+
+CVector C4::GetPos() {
+    CVector ret_out;
+    plugin::CallMethodDynGlobal<C4 *, CVector *>(gaddrof(C4::GetPos), this, &ret_out);
+    return ret_out;
+}
+
+int addrof(C4::SetName) = ADDRESS_BY_VERSION(0x4050C0, 0x4050D0, 0x4050E0);
+int gaddrof(C4::SetName) = GLOBAL_ADDRESS_BY_VERSION(0x4050C0, 0x4050D0, 0x4050E0);
+
+void C4::SetName(wchar_t *name) {
+    plugin::CallMethodDynGlobal<C4 *, wchar_t *>(gaddrof(C4::SetName), this, name);
+}
+
+int addrof_o(C4::Update, int (*)(float)) = ADDRESS_BY_VERSION(0x4050F0, 0x405100, 0x405110);
+int gaddrof_o(C4::Update, int (*)(float)) = GLOBAL_ADDRESS_BY_VERSION(0x4050F0, 0x405100, 0x405110);
+
+int C4::Update(float dt) {
+    return plugin::CallAndReturnDynGlobal<int, float>(gaddrof_o(C4::Update, int (*)(float)), dt);
+}
+
+int addrof_o(C4::Update, int (*)(float, int)) = ADDRESS_BY_VERSION(0x405120, 0x405130, 0x405140);
+int gaddrof_o(C4::Update, int (*)(float, int)) = GLOBAL_ADDRESS_BY_VERSION(0x405120, 0x405130, 0x405140);
+
+int C4::Update(float dt, int x) {
+    return plugin::CallAndReturnDynGlobal<int, float, int>(gaddrof_o(C4::Update, int (*)(float, int)), dt, x);
+}
+
+int addrof(GlobalFunc4) = ADDRESS_BY_VERSION(0x4051B0, 0x4051C0, 0x4051D0);
+int gaddrof(GlobalFunc4) = GLOBAL_ADDRESS_BY_VERSION(0x4051B0, 0x4051C0, 0x4051D0);
+
+void GlobalFunc4(char const *fmt, ... arg2) {
+    plugin::CallDynGlobal<char const *, ...>(gaddrof(GlobalFunc4), fmt, arg2);
+}
@@ -0,0 +1,80 @@
+/*
+    Plugin-SDK (Grand Theft Auto 3) source file
+    Authors: GTA Community. See more here
+    https://github.com/DK22Pac/plugin-sdk
+    Do not delete this comment block. Respect others' work!
+*/
+#include "C6.h"
+
+PLUGIN_SOURCE_FILE
+
+PLUGIN_VARIABLE C6 *&C6::Inner::ms_x = *reinterpret_cast<C6 **>(GLOBAL_ADDRESS_BY_VERSION(0xB00068, 0xB0006C, 0xB00070));
+PLUGIN_VARIABLE int &C6::ms_count = *reinterpret_cast<int *>(GLOBAL_ADDRESS_BY_VERSION(0xB00060, 0xB00064, 0xB00068));
+PLUGIN_VARIABLE float const(&g_array6)[4] = *reinterpret_cast<float const(*)[4]>(GLOBAL_ADDRESS_BY_VERSION(0xB00064, 0xB00068, 0xB0006C));
+
+int ctor_addr(C6) = ADDRESS_BY_VERSION(0x407030, 0x407040, 0x407050);
+int ctor_gaddr(C6) = GLOBAL_ADDRESS_BY_VERSION(0x407030, 0x407040, 0x407050);
+
+int dtor_addr(C6) = ADDRESS_BY_VERSION(0x407060, 0, 0);
+int dtor_gaddr(C6) = GLOBAL_ADDRESS_BY_VERSION(0x407060, 0, 0);
+
+int op_new_addr(C6) = ADDRESS_BY_VERSION(0x4071E0, 0x4071F0, 0x407200);
+int op_new_gaddr(C6) = GLOBAL_ADDRESS_BY_VERSION(0x4071E0, 0x4071F0, 0x407200);
+
+int addrof(C6::operator==) = ADDRESS_BY_VERSION(0x4071B0, 0x4071C0, 0x4071D0);
+int gaddrof(C6::operator==) = GLOBAL_ADDRESS_BY_VERSION(0x4071B0, 0x4071C0, 0x4071D0);
+
+bool C6::operator==(C6 &other) {
+    return plugin::CallMethodAndReturnDynGlobal<bool, C6 *, C6 &>(gaddrof(C6::operator==), this, other);
+}
+
+int addrof(C6::Process) = ADDRESS_BY_VERSION(0x407090, 0x4070A0, 0x4070B0);
+int gaddrof(C6::Process) = GLOBAL_ADDRESS_BY_VERSION(0x407090, 0x4070A0, 0x4070B0);
+
+void C6::Process() {
+    plugin::CallVirtualMethod<1, C6 *>(this);
+}
+
+int addrof(C6::Render) = ADDRESS_BY_VERSION(0x4070C0, 0x4070D0, 0x4070E0);
+int gaddrof(C6::Render) = GLOBAL_ADDRESS_BY_VERSION(0x4070C0, 0x4070D0, 0x4070E0);
+
+bool C6::Render(int mode) {
+    return plugin::CallVirtualMethodAndReturn<bool, 2, C6 *, int>(this, mode);
+}
+
+int addrof(C6::GetPos) = ADDRESS_BY_VERSION(0x4070F0, 0x407100, 0x407110);
+int gaddrof(C6::GetPos) = GLOBAL_ADDRESS_BY_VERSION(0x4070F0, 0x407100, 0x407110);
+
+CVector C6::GetPos() {
+    CVector ret_out;
+    plugin::CallMethodDynGlobal<C6 *, CVector *>(gaddrof(C6::GetPos), this, &ret_out);
+    return ret_out;
+}
+
+int addrof(C6::SetName) = ADDRESS_BY_VERSION(0x407120, 0x407130, 0x407140);
+int gaddrof(C6::SetName) = GLOBAL_ADDRESS_BY_VERSION(0x407120, 0x407130, 0x407140);
+
+void C6::SetName(wchar_t *name) {
+    plugin::CallMethodDynGlobal<C6 *, wchar_t *>(gaddrof(C6::SetName), this, name);
+}
+
+int addrof_o(C6::Update, int (*)(float)) = ADDRESS_BY_VERSION(0x407150, 0, 0);
+int gaddrof_o(C6::Update, int (*)(float)) = GLOBAL_ADDRESS_BY_VERSION(0x407150, 0, 0);
+
+int C6::Update(float dt) {
+    return plugin::CallAndReturnDynGlobal<int, float>(gaddrof_o(C6::Update, int (*)(float)), dt);
+}
+
+int addrof_o(C6::Update, int (*)(float, int)) = ADDRESS_BY_VERSION(0x407180, 0x407190, 0x4071A0);
+int gaddrof_o(C6::Update, int (*)(float, int)) = GLOBAL_ADDRESS_BY_VERSION(0x407180, 0x407190, 0x4071A0);
+
+int C6::Update(float dt, int x) {
+    return plugin::CallAndReturnDynGlobal<int, float, int>(gaddrof_o(C6::Update, int (*)(float, int)), dt, x);
+}
+
+int addrof(GlobalFunc6) = ADDRESS_BY_VERSION(0x407210, 0x407220, 0x407230);
+int gaddrof(GlobalFunc6) = GLOBAL_ADDRESS_BY_VERSION(0x407210, 0x407220, 0x407230);
+
+void GlobalFunc6(char const *fmt, ... arg2) {
+    plugin::CallDynGlobal<char const *, ...>(gaddrof(GlobalFunc6), fmt, arg2);
+}
@@ -0,0 +1,60 @@
+/*
+    Plugin-SDK (Grand Theft Auto 3) header file
+    Authors: GTA Community. See more here
+    https://github.com/DK22Pac/plugin-sdk
+    Do not delete this comment block. Respect others' work!
+*/
+#pragma once
+
+#include "PluginBase.h"
+#include "C2.h"
+#include "CVector.h"
+#include "CList.h"
+#include "C3.h"
+
+class C0;
+
+//! class 6
+class PLUGIN_API C6 : public C2 {
+    PLUGIN_NO_DEFAULT_CONSTRUCTION(C6)
+
+public:
+    class PLUGIN_API Inner {
+    public:
+        SUPPORTED_10EN_11EN_STEAM static C6 *&ms_x;
+    };
+
+    float m_fValue;
+    C0 *m_pNext;
+    CVector m_vec; //!< vector
+    CList<C3 *> m_list;
+    void(*m_cb)(int , C6 *);
+
+    //! counter
+    SUPPORTED_10EN_11EN_STEAM static int &ms_count;
+
+    SUPPORTED_10EN_11EN_STEAM bool operator==(C6 &other);
+
+    // virtual function #0 (not found)
+
+    SUPPORTED_10EN_11EN_STEAM void Process();
+    SUPPORTED_10EN_11EN_STEAM bool Render(int mode);
+
+    // virtual function #3 (not found)
+
+
+    SUPPORTED_10EN_11EN_STEAM CVector GetPos();
+    SUPPORTED_10EN_11EN_STEAM void SetName(wchar_t *name);
+
+    SUPPORTED_10EN static int Update(float dt);
+    SUPPORTED_10EN_11EN_STEAM static int Update(float dt, int x);
+};
+
+SUPPORTED_10EN_11EN_STEAM extern float const(&g_array6)[4]; // float g_array6[4]
+
+SUPPORTED_10EN_11EN_STEAM void GlobalFunc6(char const *fmt, ... arg2);
+
+VTABLE_DESC(C6, 0x860060, 4);
+VALIDATE_SIZE(C6, 0x28);
+
+#include "meta/meta.C6.h"
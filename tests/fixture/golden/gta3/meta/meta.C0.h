@@ -0,0 +1,191 @@
+/*
+    Plugin-SDK (Grand Theft Auto 3) header file
+    Authors: GTA Community. See more here
+    https://github.com/DK22Pac/plugin-sdk
+    Do not delete this comment block. Respect others' work!
+*/
+#include "PluginBase.h"
+
+namespace plugin {
+
+CTOR_META_BEGIN(C0)
+static int address;
+static int global_address;
+static const int id = 0x401030;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x401030, 0x401040, 0x401050>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x401035,100,1,0,0, 0x401031,110,1,0,0, 0x401032,120,1,0,0>;
+using def_t = void(C0 *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C0 *>, 0>;
+META_END
+
+CTOR_META_BEGIN_OVERLOADED(C0, void(int, float))
+static int address;
+static int global_address;
+static const int id = 0x401060;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x401060, 0x401070, 0x401080>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x401065,100,1,0,0, 0x401061,110,1,0,0, 0x401062,120,1,0,0>;
+using def_t = void(C0 *, int, float);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C0 *,int,float>, 0,1,2>;
+META_END
+
+DTOR_META_BEGIN(C0)
+static int address;
+static int global_address;
+static const int id = 0x401090;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x401090, 0x4010A0, 0x4010B0>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x401095,100,1,0,0, 0x401091,110,1,0,0, 0x401092,120,1,0,0>;
+using def_t = void(C0 *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C0 *>, 0>;
+META_END
+
+META_BEGIN(C0::Process)
+static int address;
+static int global_address;
+static const int id = 0x4010C0;
+static const bool is_virtual = true;
+static const int vtable_index = 1;
+using mv_addresses_t = MvAddresses<0x4010C0, 0, 0>;
+// total references count: 10en (1), 11en (0), steam (0)
+using refs_t = RefList<0x4010C5,100,1,0,0>;
+using def_t = void(C0 *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C0 *>, 0>;
+META_END
+
+META_BEGIN(C0::Render)
+static int address;
+static int global_address;
+static const int id = 0x4010F0;
+static const bool is_virtual = true;
+static const int vtable_index = 2;
+using mv_addresses_t = MvAddresses<0x4010F0, 0x401100, 0x401110>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x4010F5,100,1,0,0, 0x4010F1,110,1,0,0, 0x4010F2,120,1,0,0>;
+using def_t = bool(C0 *, int);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C0 *,int>, 0,1>;
+META_END
+
+META_BEGIN(C0::GetPos)
+static int address;
+static int global_address;
+static const int id = 0x401120;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x401120, 0x401130, 0x401140>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x401125,100,1,0,0, 0x401121,110,1,0,0, 0x401122,120,1,0,0>;
+using def_t = CVector *(C0 *, CVector *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C0 *,CVector *>, 0,1>;
+META_END
+
+META_BEGIN(C0::SetName)
+static int address;
+static int global_address;
+static const int id = 0x401150;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x401150, 0x401160, 0x401170>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x401155,100,1,0,0, 0x401151,110,1,0,0, 0x401152,120,1,0,0>;
+using def_t = void(C0 *, wchar_t *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C0 *,wchar_t *>, 0,1>;
+META_END
+
+META_BEGIN_OVERLOADED(C0::Update, int (*)(float))
+static int address;
+static int global_address;
+static const int id = 0x401180;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x401180, 0x401190, 0x4011A0>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x401185,100,1,0,0, 0x401181,110,1,0,0, 0x401182,120,1,0,0>;
+using def_t = int(float);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<float>, 0>;
+META_END
+
+META_BEGIN_OVERLOADED(C0::Update, int (*)(float, int))
+static int address;
+static int global_address;
+static const int id = 0x4011B0;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x4011B0, 0, 0>;
+// total references count: 10en (1), 11en (0), steam (0)
+using refs_t = RefList<0x4011B5,100,1,0,0>;
+using def_t = int(float, int);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<float,int>, 0,1>;
+META_END
+
+META_BEGIN(C0::operator==)
+static int address;
+static int global_address;
+static const int id = 0x4011E0;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x4011E0, 0x4011F0, 0x401200>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x4011E5,100,1,0,0, 0x4011E1,110,1,0,0, 0x4011E2,120,1,0,0>;
+using def_t = bool(C0 *, C0 &);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C0 *,C0 &>, 0,1>;
+META_END
+
+OP_NEW_META_BEGIN(C0)
+static int address;
+static int global_address;
+static const int id = 0x401210;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x401210, 0x401220, 0x401230>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x401215,100,1,0,0, 0x401211,110,1,0,0, 0x401212,120,1,0,0>;
+using def_t = void *(unsigned int);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<unsigned int>, 0>;
+META_END
+
+META_BEGIN(GlobalFunc0)
+static int address;
+static int global_address;
+static const int id = 0x401240;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x401240, 0x401250, 0x401260>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x401245,100,1,0,0, 0x401241,110,1,0,0, 0x401242,120,1,0,0>;
+using def_t = void(char const *, ...);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<char const *,...>, 0,1>;
+META_END
+
+}
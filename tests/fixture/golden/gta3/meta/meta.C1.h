@@ -0,0 +1,131 @@
+/*
+    Plugin-SDK (Grand Theft Auto 3) header file
+    Authors: GTA Community. See more here
+    https://github.com/DK22Pac/plugin-sdk
+    Do not delete this comment block. Respect others' work!
+*/
+#include "PluginBase.h"
+
+namespace plugin {
+
+CTOR_META_BEGIN(C1)
+static int address;
+static int global_address;
+static const int id = 0x402030;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x402030, 0x402040, 0x402050>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x402035,100,1,0,0, 0x402031,110,1,0,0, 0x402032,120,1,0,0>;
+using def_t = void(C1 *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C1 *>, 0>;
+META_END
+
+META_BEGIN(C1::GetPos)
+static int address;
+static int global_address;
+static const int id = 0x402060;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x402060, 0x402070, 0x402080>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x402065,100,1,0,0, 0x402061,110,1,0,0, 0x402062,120,1,0,0>;
+using def_t = CVector *(C1 *, CVector *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C1 *,CVector *>, 0,1>;
+META_END
+
+META_BEGIN(C1::SetName)
+static int address;
+static int global_address;
+static const int id = 0x402090;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x402090, 0, 0>;
+// total references count: 10en (1), 11en (0), steam (0)
+using refs_t = RefList<0x402095,100,1,0,0>;
+using def_t = void(C1 *, wchar_t *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C1 *,wchar_t *>, 0,1>;
+META_END
+
+META_BEGIN_OVERLOADED(C1::Update, int (*)(float))
+static int address;
+static int global_address;
+static const int id = 0x4020C0;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x4020C0, 0x4020D0, 0x4020E0>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x4020C5,100,1,0,0, 0x4020C1,110,1,0,0, 0x4020C2,120,1,0,0>;
+using def_t = int(float);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<float>, 0>;
+META_END
+
+META_BEGIN_OVERLOADED(C1::Update, int (*)(float, int))
+static int address;
+static int global_address;
+static const int id = 0x4020F0;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x4020F0, 0x402100, 0x402110>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x4020F5,100,1,0,0, 0x4020F1,110,1,0,0, 0x4020F2,120,1,0,0>;
+using def_t = int(float, int);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<float,int>, 0,1>;
+META_END
+
+META_BEGIN(C1::operator==)
+static int address;
+static int global_address;
+static const int id = 0x402120;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x402120, 0x402130, 0x402140>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x402125,100,1,0,0, 0x402121,110,1,0,0, 0x402122,120,1,0,0>;
+using def_t = bool(C1 *, C1 &);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C1 *,C1 &>, 0,1>;
+META_END
+
+OP_NEW_META_BEGIN(C1)
+static int address;
+static int global_address;
+static const int id = 0x402150;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x402150, 0x402160, 0x402170>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x402155,100,1,0,0, 0x402151,110,1,0,0, 0x402152,120,1,0,0>;
+using def_t = void *(unsigned int);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<unsigned int>, 0>;
+META_END
+
+META_BEGIN(GlobalFunc1)
+static int address;
+static int global_address;
+static const int id = 0x402180;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x402180, 0, 0>;
+// total references count: 10en (1), 11en (0), steam (0)
+using refs_t = RefList<0x402185,100,1,0,0>;
+using def_t = void(char const *, ...);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<char const *,...>, 0,1>;
+META_END
+
+}
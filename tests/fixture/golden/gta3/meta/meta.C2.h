@@ -0,0 +1,155 @@
+/*
+    Plugin-SDK (Grand Theft Auto 3) header file
+    Authors: GTA Community. See more here
+    https://github.com/DK22Pac/plugin-sdk
+    Do not delete this comment block. Respect others' work!
+*/
+#include "PluginBase.h"
+
+namespace plugin {
+
+CTOR_META_BEGIN(C2)
+static int address;
+static int global_address;
+static const int id = 0x403030;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x403030, 0x403040, 0x403050>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x403035,100,1,0,0, 0x403031,110,1,0,0, 0x403032,120,1,0,0>;
+using def_t = void(C2 *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C2 *>, 0>;
+META_END
+
+META_BEGIN(C2::GetPos)
+static int address;
+static int global_address;
+static const int id = 0x403060;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x403060, 0x403070, 0x403080>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x403065,100,1,0,0, 0x403061,110,1,0,0, 0x403062,120,1,0,0>;
+using def_t = CVector *(C2 *, CVector *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C2 *,CVector *>, 0,1>;
+META_END
+
+META_BEGIN(C2::SetName)
+static int address;
+static int global_address;
+static const int id = 0x403090;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x403090, 0, 0>;
+// total references count: 10en (1), 11en (0), steam (0)
+using refs_t = RefList<0x403095,100,1,0,0>;
+using def_t = void(C2 *, wchar_t *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C2 *,wchar_t *>, 0,1>;
+META_END
+
+META_BEGIN_OVERLOADED(C2::Update, int (*)(float))
+static int address;
+static int global_address;
+static const int id = 0x4030C0;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x4030C0, 0x4030D0, 0x4030E0>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x4030C5,100,1,0,0, 0x4030C1,110,1,0,0, 0x4030C2,120,1,0,0>;
+using def_t = int(float);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<float>, 0>;
+META_END
+
+META_BEGIN_OVERLOADED(C2::Update, int (*)(float, int))
+static int address;
+static int global_address;
+static const int id = 0x4030F0;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x4030F0, 0x403100, 0x403110>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x4030F5,100,1,0,0, 0x4030F1,110,1,0,0, 0x4030F2,120,1,0,0>;
+using def_t = int(float, int);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<float,int>, 0,1>;
+META_END
+
+META_BEGIN(C2::operator==)
+static int address;
+static int global_address;
+static const int id = 0x403120;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x403120, 0x403130, 0x403140>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x403125,100,1,0,0, 0x403121,110,1,0,0, 0x403122,120,1,0,0>;
+using def_t = bool(C2 *, C2 &);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C2 *,C2 &>, 0,1>;
+META_END
+
+OP_NEW_META_BEGIN(C2)
+static int address;
+static int global_address;
+static const int id = 0x403150;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x403150, 0x403160, 0x403170>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x403155,100,1,0,0, 0x403151,110,1,0,0, 0x403152,120,1,0,0>;
+using def_t = void *(unsigned int);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<unsigned int>, 0>;
+META_END
+
+META_BEGIN(GlobalFunc2)
+static int address;
+static int global_address;
+static const int id = 0x403180;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x403180, 0, 0>;
+// total references count: 10en (1), 11en (0), steam (0)
+using refs_t = RefList<0x403185,100,1,0,0>;
+using def_t = void(char const *, ...);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<char const *,...>, 0,1>;
+META_END
+
+template<>
+struct stack_object<C2> : stack_object_no_default<C2> {
+    SUPPORTED_10EN_11EN_STEAM stack_object() {
+        plugin::CallMethodDynGlobal<C2 *>(ctor_gaddr(C2), reinterpret_cast<C2 *>(objBuff));
+    }
+};
+
+template <>
+SUPPORTED_10EN_11EN_STEAM inline C2 *operator_new<C2>() {
+    void *objData = plugin::CallAndReturnDynGlobal<void *, unsigned int>(op_new_gaddr(C2), sizeof(C2));
+    C2 *obj = reinterpret_cast<C2 *>(objData);
+    plugin::CallMethodDynGlobal<C2 *>(ctor_gaddr(C2), obj);
+    return obj;
+}
+template <>
+SUPPORTED_10EN_11EN_STEAM inline C2 *operator_new_array<C2>(unsigned int objCount) {
+    void *objData = operator new(sizeof(C2) * objCount + 4); 
+    *reinterpret_cast<unsigned int *>(objData) = objCount;
+    C2 *objArray = reinterpret_cast<C2 *>(reinterpret_cast<unsigned int>(objData) + 4);
+    for (unsigned int i = 0; i < objCount; i++)
+        plugin::CallMethodDynGlobal<C2 *>(ctor_gaddr(C2), &objArray[i]);
+    return objArray;
+}
+
+}
@@ -0,0 +1,176 @@
+/*
+    Plugin-SDK (Grand Theft Auto 3) header file
+    Authors: GTA Community. See more here
+    https://github.com/DK22Pac/plugin-sdk
+    Do not delete this comment block. Respect others' work!
+*/
+#include "PluginBase.h"
+
+namespace plugin {
+
+CTOR_META_BEGIN(C3)
+static int address;
+static int global_address;
+static const int id = 0x404030;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x404030, 0x404040, 0x404050>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x404035,100,1,0,0, 0x404031,110,1,0,0, 0x404032,120,1,0,0>;
+using def_t = void(C3 *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C3 *>, 0>;
+META_END
+
+DTOR_META_BEGIN(C3)
+static int address;
+static int global_address;
+static const int id = 0x404060;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x404060, 0x404070, 0x404080>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x404065,100,1,0,0, 0x404061,110,1,0,0, 0x404062,120,1,0,0>;
+using def_t = void(C3 *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C3 *>, 0>;
+META_END
+
+META_BEGIN(C3::Process)
+static int address;
+static int global_address;
+static const int id = 0x404090;
+static const bool is_virtual = true;
+static const int vtable_index = 1;
+using mv_addresses_t = MvAddresses<0x404090, 0, 0>;
+// total references count: 10en (1), 11en (0), steam (0)
+using refs_t = RefList<0x404095,100,1,0,0>;
+using def_t = void(C3 *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C3 *>, 0>;
+META_END
+
+META_BEGIN(C3::Render)
+static int address;
+static int global_address;
+static const int id = 0x4040C0;
+static const bool is_virtual = true;
+static const int vtable_index = 2;
+using mv_addresses_t = MvAddresses<0x4040C0, 0x4040D0, 0x4040E0>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x4040C5,100,1,0,0, 0x4040C1,110,1,0,0, 0x4040C2,120,1,0,0>;
+using def_t = bool(C3 *, int);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C3 *,int>, 0,1>;
+META_END
+
+META_BEGIN(C3::GetPos)
+static int address;
+static int global_address;
+static const int id = 0x4040F0;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x4040F0, 0x404100, 0x404110>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x4040F5,100,1,0,0, 0x4040F1,110,1,0,0, 0x4040F2,120,1,0,0>;
+using def_t = CVector *(C3 *, CVector *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C3 *,CVector *>, 0,1>;
+META_END
+
+META_BEGIN(C3::SetName)
+static int address;
+static int global_address;
+static const int id = 0x404120;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x404120, 0x404130, 0x404140>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x404125,100,1,0,0, 0x404121,110,1,0,0, 0x404122,120,1,0,0>;
+using def_t = void(C3 *, wchar_t *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C3 *,wchar_t *>, 0,1>;
+META_END
+
+META_BEGIN_OVERLOADED(C3::Update, int (*)(float))
+static int address;
+static int global_address;
+static const int id = 0x404150;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x404150, 0x404160, 0x404170>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x404155,100,1,0,0, 0x404151,110,1,0,0, 0x404152,120,1,0,0>;
+using def_t = int(float);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<float>, 0>;
+META_END
+
+META_BEGIN_OVERLOADED(C3::Update, int (*)(float, int))
+static int address;
+static int global_address;
+static const int id = 0x404180;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x404180, 0, 0>;
+// total references count: 10en (1), 11en (0), steam (0)
+using refs_t = RefList<0x404185,100,1,0,0>;
+using def_t = int(float, int);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<float,int>, 0,1>;
+META_END
+
+META_BEGIN(C3::operator==)
+static int address;
+static int global_address;
+static const int id = 0x4041B0;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x4041B0, 0x4041C0, 0x4041D0>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x4041B5,100,1,0,0, 0x4041B1,110,1,0,0, 0x4041B2,120,1,0,0>;
+using def_t = bool(C3 *, C3 &);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C3 *,C3 &>, 0,1>;
+META_END
+
+OP_NEW_META_BEGIN(C3)
+static int address;
+static int global_address;
+static const int id = 0x4041E0;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x4041E0, 0x4041F0, 0x404200>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x4041E5,100,1,0,0, 0x4041E1,110,1,0,0, 0x4041E2,120,1,0,0>;
+using def_t = void *(unsigned int);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<unsigned int>, 0>;
+META_END
+
+META_BEGIN(GlobalFunc3)
+static int address;
+static int global_address;
+static const int id = 0x404210;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x404210, 0x404220, 0x404230>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x404215,100,1,0,0, 0x404211,110,1,0,0, 0x404212,120,1,0,0>;
+using def_t = void(char const *, ...);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<char const *,...>, 0,1>;
+META_END
+
+}
@@ -0,0 +1,131 @@
+/*
+    Plugin-SDK (Grand Theft Auto 3) header file
+    Authors: GTA Community. See more here
+    https://github.com/DK22Pac/plugin-sdk
+    Do not delete this comment block. Respect others' work!
+*/
+#include "PluginBase.h"
+
+namespace plugin {
+
+CTOR_META_BEGIN(C5)
+static int address;
+static int global_address;
+static const int id = 0x406030;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x406030, 0x406040, 0x406050>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x406035,100,1,0,0, 0x406031,110,1,0,0, 0x406032,120,1,0,0>;
+using def_t = void(C5 *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C5 *>, 0>;
+META_END
+
+META_BEGIN(C5::GetPos)
+static int address;
+static int global_address;
+static const int id = 0x406060;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x406060, 0, 0>;
+// total references count: 10en (1), 11en (0), steam (0)
+using refs_t = RefList<0x406065,100,1,0,0>;
+using def_t = CVector *(C5 *, CVector *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C5 *,CVector *>, 0,1>;
+META_END
+
+META_BEGIN(C5::SetName)
+static int address;
+static int global_address;
+static const int id = 0x406090;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x406090, 0x4060A0, 0x4060B0>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x406095,100,1,0,0, 0x406091,110,1,0,0, 0x406092,120,1,0,0>;
+using def_t = void(C5 *, wchar_t *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C5 *,wchar_t *>, 0,1>;
+META_END
+
+META_BEGIN_OVERLOADED(C5::Update, int (*)(float))
+static int address;
+static int global_address;
+static const int id = 0x4060C0;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x4060C0, 0x4060D0, 0x4060E0>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x4060C5,100,1,0,0, 0x4060C1,110,1,0,0, 0x4060C2,120,1,0,0>;
+using def_t = int(float);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<float>, 0>;
+META_END
+
+META_BEGIN_OVERLOADED(C5::Update, int (*)(float, int))
+static int address;
+static int global_address;
+static const int id = 0x4060F0;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x4060F0, 0x406100, 0x406110>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x4060F5,100,1,0,0, 0x4060F1,110,1,0,0, 0x4060F2,120,1,0,0>;
+using def_t = int(float, int);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<float,int>, 0,1>;
+META_END
+
+META_BEGIN(C5::operator==)
+static int address;
+static int global_address;
+static const int id = 0x406120;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x406120, 0x406130, 0x406140>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x406125,100,1,0,0, 0x406121,110,1,0,0, 0x406122,120,1,0,0>;
+using def_t = bool(C5 *, C5 &);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C5 *,C5 &>, 0,1>;
+META_END
+
+OP_NEW_META_BEGIN(C5)
+static int address;
+static int global_address;
+static const int id = 0x406150;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x406150, 0, 0>;
+// total references count: 10en (1), 11en (0), steam (0)
+using refs_t = RefList<0x406155,100,1,0,0>;
+using def_t = void *(unsigned int);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<unsigned int>, 0>;
+META_END
+
+META_BEGIN(GlobalFunc5)
+static int address;
+static int global_address;
+static const int id = 0x406180;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x406180, 0x406190, 0x4061A0>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x406185,100,1,0,0, 0x406181,110,1,0,0, 0x406182,120,1,0,0>;
+using def_t = void(char const *, ...);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<char const *,...>, 0,1>;
+META_END
+
+}
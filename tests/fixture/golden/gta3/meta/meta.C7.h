@@ -0,0 +1,155 @@
+/*
+    Plugin-SDK (Grand Theft Auto 3) header file
+    Authors: GTA Community. See more here
+    https://github.com/DK22Pac/plugin-sdk
+    Do not delete this comment block. Respect others' work!
+*/
+#include "PluginBase.h"
+
+namespace plugin {
+
+CTOR_META_BEGIN(C7)
+static int address;
+static int global_address;
+static const int id = 0x408030;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x408030, 0, 0>;
+// total references count: 10en (1), 11en (0), steam (0)
+using refs_t = RefList<0x408035,100,1,0,0>;
+using def_t = void(C7 *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C7 *>, 0>;
+META_END
+
+META_BEGIN(C7::GetPos)
+static int address;
+static int global_address;
+static const int id = 0x408060;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x408060, 0x408070, 0x408080>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x408065,100,1,0,0, 0x408061,110,1,0,0, 0x408062,120,1,0,0>;
+using def_t = CVector *(C7 *, CVector *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C7 *,CVector *>, 0,1>;
+META_END
+
+META_BEGIN(C7::SetName)
+static int address;
+static int global_address;
+static const int id = 0x408090;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x408090, 0x4080A0, 0x4080B0>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x408095,100,1,0,0, 0x408091,110,1,0,0, 0x408092,120,1,0,0>;
+using def_t = void(C7 *, wchar_t *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C7 *,wchar_t *>, 0,1>;
+META_END
+
+META_BEGIN_OVERLOADED(C7::Update, int (*)(float))
+static int address;
+static int global_address;
+static const int id = 0x4080C0;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x4080C0, 0x4080D0, 0x4080E0>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x4080C5,100,1,0,0, 0x4080C1,110,1,0,0, 0x4080C2,120,1,0,0>;
+using def_t = int(float);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<float>, 0>;
+META_END
+
+META_BEGIN_OVERLOADED(C7::Update, int (*)(float, int))
+static int address;
+static int global_address;
+static const int id = 0x4080F0;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x4080F0, 0x408100, 0x408110>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x4080F5,100,1,0,0, 0x4080F1,110,1,0,0, 0x4080F2,120,1,0,0>;
+using def_t = int(float, int);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<float,int>, 0,1>;
+META_END
+
+META_BEGIN(C7::operator==)
+static int address;
+static int global_address;
+static const int id = 0x408120;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x408120, 0, 0>;
+// total references count: 10en (1), 11en (0), steam (0)
+using refs_t = RefList<0x408125,100,1,0,0>;
+using def_t = bool(C7 *, C7 &);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C7 *,C7 &>, 0,1>;
+META_END
+
+OP_NEW_META_BEGIN(C7)
+static int address;
+static int global_address;
+static const int id = 0x408150;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x408150, 0x408160, 0x408170>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x408155,100,1,0,0, 0x408151,110,1,0,0, 0x408152,120,1,0,0>;
+using def_t = void *(unsigned int);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<unsigned int>, 0>;
+META_END
+
+META_BEGIN(GlobalFunc7)
+static int address;
+static int global_address;
+static const int id = 0x408180;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x408180, 0x408190, 0x4081A0>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x408185,100,1,0,0, 0x408181,110,1,0,0, 0x408182,120,1,0,0>;
+using def_t = void(char const *, ...);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<char const *,...>, 0,1>;
+META_END
+
+template<>
+struct stack_object<C7> : stack_object_no_default<C7> {
+    SUPPORTED_10EN stack_object() {
+        plugin::CallMethodDynGlobal<C7 *>(ctor_gaddr(C7), reinterpret_cast<C7 *>(objBuff));
+    }
+};
+
+template <>
+SUPPORTED_10EN inline C7 *operator_new<C7>() {
+    void *objData = plugin::CallAndReturnDynGlobal<void *, unsigned int>(op_new_gaddr(C7), sizeof(C7));
+    C7 *obj = reinterpret_cast<C7 *>(objData);
+    plugin::CallMethodDynGlobal<C7 *>(ctor_gaddr(C7), obj);
+    return obj;
+}
+template <>
+SUPPORTED_10EN inline C7 *operator_new_array<C7>(unsigned int objCount) {
+    void *objData = operator new(sizeof(C7) * objCount + 4); 
+    *reinterpret_cast<unsigned int *>(objData) = objCount;
+    C7 *objArray = reinterpret_cast<C7 *>(reinterpret_cast<unsigned int>(objData) + 4);
+    for (unsigned int i = 0; i < objCount; i++)
+        plugin::CallMethodDynGlobal<C7 *>(ctor_gaddr(C7), &objArray[i]);
+    return objArray;
+}
+
+}
@@ -0,0 +1,72 @@
+/*
+    Plugin-SDK (Grand Theft Auto San Andreas) header file
+    Authors: GTA Community. See more here
+    https://github.com/DK22Pac/plugin-sdk
+    Do not delete this comment block. Respect others' work!
+*/
+#pragma once
+
+#include "PluginBase.h"
+#include "C0.h"
+#include "C2.h"
+#include "CVector.h"
+#include "CList.h"
+#include "C3.h"
+
+//! class 1
+struct PLUGIN_API C1 : public C0 {
+private:
+    PLUGIN_NO_DEFAULT_CONSTRUCTION(C1)
+
+public:
+    class PLUGIN_API Inner {
+    public:
+        SUPPORTED_10US_10EU_11US_11EU_SR2_SR2LV static C1 *&ms_x;
+    };
+
+    float m_fValue;
+    C2 *m_pNext;
+    struct {
+        unsigned short bOne : 1;
+        unsigned short nTwoWords : 3;
+        unsigned short : 12;
+    } m_nFlags;
+private:
+    char _pad12[2];
+public:
+    CVector m_vec; //!< vector
+    CList<C0 *> m_list;
+    void(*m_cb)(int , C1 *);
+
+    //! counter
+    SUPPORTED_10US_10EU_11US_11EU_SR2_SR2LV static int &ms_count;
+
+    SUPPORTED_10US_10EU_11US_11EU_SR2_SR2LV bool operator==(C1 &other);
+
+    // virtual function #0 (not overriden)
+
+
+    // virtual function #1 (not overriden)
+
+
+    // virtual function #2 (not overriden)
+
+
+    // virtual function #3 (not overriden)
+
+
+    SUPPORTED_10US_10EU_11US_11EU_SR2_SR2LV CVector GetPos();
+    SUPPORTED_10US void SetName(wchar_t *name);
+
+    SUPPORTED_10US_10EU_11US_11EU_SR2_SR2LV static int Update(float dt);
+    SUPPORTED_10US_10EU_11US_11EU_SR2_SR2LV static int Update(float dt, int x);
+};
+
+SUPPORTED_10US_10EU_11US_11EU_SR2_SR2LV extern float const(&g_array1)[4]; // float g_array1[4]
+
+SUPPORTED_10US void GlobalFunc1(char const *fmt, ... arg2);
+
+VTABLE_DESC(C1, 0x860010, 4);
+VALIDATE_SIZE(C1, 0x2C);
+
+#include "meta/meta.C1.h"
@@ -0,0 +1,63 @@
+/*
+    Plugin-SDK (Grand Theft Auto San Andreas) source file
+    Authors: GTA Community. See more here
+    https://github.com/DK22Pac/plugin-sdk
+    Do not delete this comment block. Respect others' work!
+*/
+#include "C2.h"
+
+PLUGIN_SOURCE_FILE
+
+PLUGIN_VARIABLE C2 *&C2::Inner::ms_x = *reinterpret_cast<C2 **>(GLOBAL_ADDRESS_BY_VERSION(0xB00028, 0xB00030, 0xB00034, 0xB00038, 0xB0003C, 0xB00040));
+PLUGIN_VARIABLE int &C2::ms_count = *reinterpret_cast<int *>(GLOBAL_ADDRESS_BY_VERSION(0xB00020, 0xB00028, 0xB0002C, 0xB00030, 0xB00034, 0xB00038));
+PLUGIN_VARIABLE float const(&g_array2)[4] = *reinterpret_cast<float const(*)[4]>(GLOBAL_ADDRESS_BY_VERSION(0xB00024, 0xB0002C, 0xB00030, 0xB00034, 0xB00038, 0xB0003C));
+
+int ctor_addr(C2) = ADDRESS_BY_VERSION(0x403030, 0x403050, 0x403060, 0x403070, 0x403080, 0x403090);
+int ctor_gaddr(C2) = GLOBAL_ADDRESS_BY_VERSION(0x403030, 0x403050, 0x403060, 0x403070, 0x403080, 0x403090);
+
+int op_new_addr(C2) = ADDRESS_BY_VERSION(0x403150, 0x403170, 0x403180, 0x403190, 0x4031A0, 0x4031B0);
+int op_new_gaddr(C2) = GLOBAL_ADDRESS_BY_VERSION(0x403150, 0x403170, 0x403180, 0x403190, 0x4031A0, 0x4031B0);
+
+int addrof(C2::operator==) = ADDRESS_BY_VERSION(0x403120, 0x403140, 0x403150, 0x403160, 0x403170, 0x403180);
+int gaddrof(C2::operator==) = GLOBAL_ADDRESS_BY_VERSION(0x403120, 0x403140, 0x403150, 0x403160, 0x403170, 0x403180);
+
+bool C2::operator==(C2 &other) {
+    return plugin::CallMethodAndReturnDynGlobal<bool, C2 *, C2 &>(gaddrof(C2::operator==), this, other);
+}
+
+int addrof(C2::GetPos) = ADDRESS_BY_VERSION(0x403060, 0x403080, 0x403090, 0x4030A0, 0x4030B0, 0x4030C0);
+int gaddrof(C2::GetPos) = GLOBAL_ADDRESS_BY_VERSION(0x403060, 0x403080, 0x403090, 0x4030A0, 0x4030B0, 0x4030C0);
+
+CVector C2::GetPos() {
+    CVector ret_out;
+    plugin::CallMethodDynGlobal<C2 *, CVector *>(gaddrof(C2::GetPos), this, &ret_out);
+    return ret_out;
+}
+
+int addrof(C2::SetName) = ADDRESS_BY_VERSION(0x403090, 0, 0, 0, 0, 0);
+int gaddrof(C2::SetName) = GLOBAL_ADDRESS_BY_VERSION(0x403090, 0, 0, 0, 0, 0);
+
+void C2::SetName(wchar_t *name) {
+    plugin::CallMethodDynGlobal<C2 *, wchar_t *>(gaddrof(C2::SetName), this, name);
+}
+
+int addrof_o(C2::Update, int (*)(float)) = ADDRESS_BY_VERSION(0x4030C0, 0x4030E0, 0x4030F0, 0x403100, 0x403110, 0x403120);
+int gaddrof_o(C2::Update, int (*)(float)) = GLOBAL_ADDRESS_BY_VERSION(0x4030C0, 0x4030E0, 0x4030F0, 0x403100, 0x403110, 0x403120);
+
+int C2::Update(float dt) {
+    return plugin::CallAndReturnDynGlobal<int, float>(gaddrof_o(C2::Update, int (*)(float)), dt);
+}
+
+int addrof_o(C2::Update, int (*)(float, int)) = ADDRESS_BY_VERSION(0x4030F0, 0x403110, 0x403120, 0x403130, 0x403140, 0x403150);
+int gaddrof_o(C2::Update, int (*)(float, int)) = GLOBAL_ADDRESS_BY_VERSION(0x4030F0, 0x403110, 0x403120, 0x403130, 0x403140, 0x403150);
+
+int C2::Update(float dt, int x) {
+    return plugin::CallAndReturnDynGlobal<int, float, int>(gaddrof_o(C2::Update, int (*)(float, int)), dt, x);
+}
+
+int addrof(GlobalFunc2) = ADDRESS_BY_VERSION(0x403180, 0, 0, 0, 0, 0);
+int gaddrof(GlobalFunc2) = GLOBAL_ADDRESS_BY_VERSION(0x403180, 0, 0, 0, 0, 0);
+
+void GlobalFunc2(char const *fmt, ... arg2) {
+    plugin::CallDynGlobal<char const *, ...>(gaddrof(GlobalFunc2), fmt, arg2);
+}
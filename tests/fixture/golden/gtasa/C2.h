@@ -0,0 +1,55 @@
+/*
+    Plugin-SDK (Grand Theft Auto San Andreas) header file
+    Authors: GTA Community. See more here
+    https://github.com/DK22Pac/plugin-sdk
+    Do not delete this comment block. Respect others' work!
+*/
+#pragma once
+
+#include "PluginBase.h"
+#include "C6.h"
+#include "CVector.h"
+#include "CList.h"
+#include "C1.h"
+
+class C0;
+
+//! class 2
+class PLUGIN_API C2 : public C0 {
+    PLUGIN_NO_DEFAULT_CONSTRUCTION(C2)
+
+public:
+    struct PLUGIN_API Nested {
+        int x;
+    };
+    class PLUGIN_API Inner {
+    public:
+        SUPPORTED_10US_10EU_11US_11EU_SR2_SR2LV static C2 *&ms_x;
+    };
+
+    float m_fValue;
+    C6 *m_pNext;
+    CVector m_vec; //!< vector
+    CList<C1 *> m_list;
+    void(*m_cb)(int , C2 *);
+
+    //! counter
+    SUPPORTED_10US_10EU_11US_11EU_SR2_SR2LV static int &ms_count;
+
+    SUPPORTED_10US_10EU_11US_11EU_SR2_SR2LV bool operator==(C2 &other);
+
+    SUPPORTED_10US_10EU_11US_11EU_SR2_SR2LV CVector GetPos();
+    SUPPORTED_10US void SetName(wchar_t *name);
+
+    SUPPORTED_10US_10EU_11US_11EU_SR2_SR2LV static int Update(float dt);
+    SUPPORTED_10US_10EU_11US_11EU_SR2_SR2LV static int Update(float dt, int x);
+};
+
+SUPPORTED_10US_10EU_11US_11EU_SR2_SR2LV extern float const(&g_array2)[4]; // float g_array2[4]
+
+SUPPORTED_10US void GlobalFunc2(char const *fmt, ... arg2);
+
+VALIDATE_SIZE(C2::Nested, 0x4);
+VALIDATE_SIZE(C2, 0x28);
+
+#include "meta/meta.C2.h"
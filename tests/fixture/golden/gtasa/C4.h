@@ -0,0 +1,57 @@
+/*
+    Plugin-SDK (Grand Theft Auto San Andreas) header file
+    Authors: GTA Community. See more here
+    https://github.com/DK22Pac/plugin-sdk
+    Do not delete this comment block. Respect others' work!
+*/
+#pragma once
+
+#include "PluginBase.h"
+#include "C1.h"
+#include "CVector.h"
+#include "CList.h"
+#include "C2.h"
+
+enum PLUGIN_API eEnum1 : unsigned int {
+    E1_0 = 0,
+    E1_1 = 1, //!< c1
+    E1_2 = 2,
+    E1_3 = 3,
+    E1_4 = 4
+};
+
+//! class 4
+class PLUGIN_API C4 : public C1 {
+    PLUGIN_NO_DEFAULT_CONSTRUCTION(C4)
+
+public:
+    class PLUGIN_API Inner {
+    public:
+        SUPPORTED_10US_10EU_11US_11EU_SR2_SR2LV static C4 *&ms_x;
+    };
+
+    float m_fValue;
+    C1 *m_pNext;
+    CVector m_vec; //!< vector
+    CList<C2 *> m_list;
+    void(*m_cb)(int , C4 *);
+
+    //! counter
+    SUPPORTED_10US_10EU_11US_11EU_SR2_SR2LV static int &ms_count;
+
+    SUPPORTED_10US bool operator==(C4 &other);
+
+    SUPPORTED_10US_10EU_11US_11EU_SR2_SR2LV CVector GetPos();
+    SUPPORTED_10US_10EU_11US_11EU_SR2_SR2LV void SetName(wchar_t *name);
+
+    SUPPORTED_10US_10EU_11US_11EU_SR2_SR2LV static int Update(float dt);
+    SUPPORTED_10US_10EU_11US_11EU_SR2_SR2LV static int Update(float dt, int x);
+};
+
+SUPPORTED_10US_10EU_11US_11EU_SR2_SR2LV extern float const(&g_array4)[4]; // float g_array4[4]
+
+SUPPORTED_10US_10EU_11US_11EU_SR2_SR2LV void GlobalFunc4(char const *fmt, ... arg2);
+
+VALIDATE_SIZE(C4, 0x28);
+
+#include "meta/meta.C4.h"
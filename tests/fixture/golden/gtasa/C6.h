@@ -0,0 +1,59 @@
+/*
+    Plugin-SDK (Grand Theft Auto San Andreas) header file
+    Authors: GTA Community. See more here
+    https://github.com/DK22Pac/plugin-sdk
+    Do not delete this comment block. Respect others' work!
+*/
+#pragma once
+
+#include "PluginBase.h"
+#include "C2.h"
+#include "C5.h"
+#include "CVector.h"
+#include "CList.h"
+#include "C3.h"
+
+//! class 6
+class PLUGIN_API C6 : public C2 {
+    PLUGIN_NO_DEFAULT_CONSTRUCTION(C6)
+
+public:
+    class PLUGIN_API Inner {
+    public:
+        SUPPORTED_10US_10EU_11US_11EU_SR2_SR2LV static C6 *&ms_x;
+    };
+
+    float m_fValue;
+    C5 *m_pNext;
+    CVector m_vec; //!< vector
+    CList<C3 *> m_list;
+    void(*m_cb)(int , C6 *);
+
+    //! counter
+    SUPPORTED_10US_10EU_11US_11EU_SR2_SR2LV static int &ms_count;
+
+    SUPPORTED_10US_10EU_11US_11EU_SR2_SR2LV bool operator==(C6 &other);
+
+    // virtual function #0 (not found)
+
+    SUPPORTED_10US_10EU_11US_11EU_SR2_SR2LV void Process();
+    SUPPORTED_10US_10EU_11US_11EU_SR2_SR2LV bool Render(int mode);
+
+    // virtual function #3 (not found)
+
+
+    SUPPORTED_10US_10EU_11US_11EU_SR2_SR2LV CVector GetPos();
+    SUPPORTED_10US_10EU_11US_11EU_SR2_SR2LV void SetName(wchar_t *name);
+
+    SUPPORTED_10US static int Update(float dt);
+    SUPPORTED_10US_10EU_11US_11EU_SR2_SR2LV static int Update(float dt, int x);
+};
+
+SUPPORTED_10US_10EU_11US_11EU_SR2_SR2LV extern float const(&g_array6)[4]; // float g_array6[4]
+
+SUPPORTED_10US_10EU_11US_11EU_SR2_SR2LV void GlobalFunc6(char const *fmt, ... arg2);
+
+VTABLE_DESC(C6, 0x860060, 4);
+VALIDATE_SIZE(C6, 0x28);
+
+#include "meta/meta.C6.h"
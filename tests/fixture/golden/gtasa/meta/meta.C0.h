@@ -0,0 +1,191 @@
+/*
+    Plugin-SDK (Grand Theft Auto San Andreas) header file
+    Authors: GTA Community. See more here
+    https://github.com/DK22Pac/plugin-sdk
+    Do not delete this comment block. Respect others' work!
+*/
+#include "PluginBase.h"
+
+namespace plugin {
+
+CTOR_META_BEGIN(C0)
+static int address;
+static int global_address;
+static const int id = 0x401030;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x401030, 0x401050, 0x401060, 0x401070, 0x401080, 0x401090>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x401035,1001,1,0,0, 0x401031,1002,1,0,0, 0x401032,1011,1,0,0, 0x401033,1101,1,0,0, 0x401034,1111,1,0,0, 0x401035,3200,1,0,0, 0x401036,3210,1,0,0>;
+using def_t = void(C0 *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C0 *>, 0>;
+META_END
+
+CTOR_META_BEGIN_OVERLOADED(C0, void(int, float))
+static int address;
+static int global_address;
+static const int id = 0x401060;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x401060, 0x401080, 0x401090, 0x4010A0, 0x4010B0, 0x4010C0>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x401065,1001,1,0,0, 0x401061,1002,1,0,0, 0x401062,1011,1,0,0, 0x401063,1101,1,0,0, 0x401064,1111,1,0,0, 0x401065,3200,1,0,0, 0x401066,3210,1,0,0>;
+using def_t = void(C0 *, int, float);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C0 *,int,float>, 0,1,2>;
+META_END
+
+DTOR_META_BEGIN(C0)
+static int address;
+static int global_address;
+static const int id = 0x401090;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x401090, 0x4010B0, 0x4010C0, 0x4010D0, 0x4010E0, 0x4010F0>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x401095,1001,1,0,0, 0x401091,1002,1,0,0, 0x401092,1011,1,0,0, 0x401093,1101,1,0,0, 0x401094,1111,1,0,0, 0x401095,3200,1,0,0, 0x401096,3210,1,0,0>;
+using def_t = void(C0 *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C0 *>, 0>;
+META_END
+
+META_BEGIN(C0::Process)
+static int address;
+static int global_address;
+static const int id = 0x4010C0;
+static const bool is_virtual = true;
+static const int vtable_index = 1;
+using mv_addresses_t = MvAddresses<0x4010C0, 0, 0, 0, 0, 0>;
+// total references count: 10us (1), 10ushl (0), 10eu (0), 11us (0), 11eu (0), sr2 (0), sr2lv (0)
+using refs_t = RefList<0x4010C5,1001,1,0,0>;
+using def_t = void(C0 *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C0 *>, 0>;
+META_END
+
+META_BEGIN(C0::Render)
+static int address;
+static int global_address;
+static const int id = 0x4010F0;
+static const bool is_virtual = true;
+static const int vtable_index = 2;
+using mv_addresses_t = MvAddresses<0x4010F0, 0x401110, 0x401120, 0x401130, 0x401140, 0x401150>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x4010F5,1001,1,0,0, 0x4010F1,1002,1,0,0, 0x4010F2,1011,1,0,0, 0x4010F3,1101,1,0,0, 0x4010F4,1111,1,0,0, 0x4010F5,3200,1,0,0, 0x4010F6,3210,1,0,0>;
+using def_t = bool(C0 *, int);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C0 *,int>, 0,1>;
+META_END
+
+META_BEGIN(C0::GetPos)
+static int address;
+static int global_address;
+static const int id = 0x401120;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x401120, 0x401140, 0x401150, 0x401160, 0x401170, 0x401180>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x401125,1001,1,0,0, 0x401121,1002,1,0,0, 0x401122,1011,1,0,0, 0x401123,1101,1,0,0, 0x401124,1111,1,0,0, 0x401125,3200,1,0,0, 0x401126,3210,1,0,0>;
+using def_t = CVector *(C0 *, CVector *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C0 *,CVector *>, 0,1>;
+META_END
+
+META_BEGIN(C0::SetName)
+static int address;
+static int global_address;
+static const int id = 0x401150;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x401150, 0x401170, 0x401180, 0x401190, 0x4011A0, 0x4011B0>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x401155,1001,1,0,0, 0x401151,1002,1,0,0, 0x401152,1011,1,0,0, 0x401153,1101,1,0,0, 0x401154,1111,1,0,0, 0x401155,3200,1,0,0, 0x401156,3210,1,0,0>;
+using def_t = void(C0 *, wchar_t *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C0 *,wchar_t *>, 0,1>;
+META_END
+
+META_BEGIN_OVERLOADED(C0::Update, int (*)(float))
+static int address;
+static int global_address;
+static const int id = 0x401180;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x401180, 0x4011A0, 0x4011B0, 0x4011C0, 0x4011D0, 0x4011E0>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x401185,1001,1,0,0, 0x401181,1002,1,0,0, 0x401182,1011,1,0,0, 0x401183,1101,1,0,0, 0x401184,1111,1,0,0, 0x401185,3200,1,0,0, 0x401186,3210,1,0,0>;
+using def_t = int(float);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<float>, 0>;
+META_END
+
+META_BEGIN_OVERLOADED(C0::Update, int (*)(float, int))
+static int address;
+static int global_address;
+static const int id = 0x4011B0;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x4011B0, 0, 0, 0, 0, 0>;
+// total references count: 10us (1), 10ushl (0), 10eu (0), 11us (0), 11eu (0), sr2 (0), sr2lv (0)
+using refs_t = RefList<0x4011B5,1001,1,0,0>;
+using def_t = int(float, int);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<float,int>, 0,1>;
+META_END
+
+META_BEGIN(C0::operator==)
+static int address;
+static int global_address;
+static const int id = 0x4011E0;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x4011E0, 0x401200, 0x401210, 0x401220, 0x401230, 0x401240>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x4011E5,1001,1,0,0, 0x4011E1,1002,1,0,0, 0x4011E2,1011,1,0,0, 0x4011E3,1101,1,0,0, 0x4011E4,1111,1,0,0, 0x4011E5,3200,1,0,0, 0x4011E6,3210,1,0,0>;
+using def_t = bool(C0 *, C0 &);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C0 *,C0 &>, 0,1>;
+META_END
+
+OP_NEW_META_BEGIN(C0)
+static int address;
+static int global_address;
+static const int id = 0x401210;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x401210, 0x401230, 0x401240, 0x401250, 0x401260, 0x401270>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x401215,1001,1,0,0, 0x401211,1002,1,0,0, 0x401212,1011,1,0,0, 0x401213,1101,1,0,0, 0x401214,1111,1,0,0, 0x401215,3200,1,0,0, 0x401216,3210,1,0,0>;
+using def_t = void *(unsigned int);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<unsigned int>, 0>;
+META_END
+
+META_BEGIN(GlobalFunc0)
+static int address;
+static int global_address;
+static const int id = 0x401240;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x401240, 0x401260, 0x401270, 0x401280, 0x401290, 0x4012A0>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x401245,1001,1,0,0, 0x401241,1002,1,0,0, 0x401242,1011,1,0,0, 0x401243,1101,1,0,0, 0x401244,1111,1,0,0, 0x401245,3200,1,0,0, 0x401246,3210,1,0,0>;
+using def_t = void(char const *, ...);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<char const *,...>, 0,1>;
+META_END
+
+}
@@ -0,0 +1,131 @@
+/*
+    Plugin-SDK (Grand Theft Auto San Andreas) header file
+    Authors: GTA Community. See more here
+    https://github.com/DK22Pac/plugin-sdk
+    Do not delete this comment block. Respect others' work!
+*/
+#include "PluginBase.h"
+
+namespace plugin {
+
+CTOR_META_BEGIN(C1)
+static int address;
+static int global_address;
+static const int id = 0x402030;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x402030, 0x402050, 0x402060, 0x402070, 0x402080, 0x402090>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x402035,1001,1,0,0, 0x402031,1002,1,0,0, 0x402032,1011,1,0,0, 0x402033,1101,1,0,0, 0x402034,1111,1,0,0, 0x402035,3200,1,0,0, 0x402036,3210,1,0,0>;
+using def_t = void(C1 *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C1 *>, 0>;
+META_END
+
+META_BEGIN(C1::GetPos)
+static int address;
+static int global_address;
+static const int id = 0x402060;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x402060, 0x402080, 0x402090, 0x4020A0, 0x4020B0, 0x4020C0>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x402065,1001,1,0,0, 0x402061,1002,1,0,0, 0x402062,1011,1,0,0, 0x402063,1101,1,0,0, 0x402064,1111,1,0,0, 0x402065,3200,1,0,0, 0x402066,3210,1,0,0>;
+using def_t = CVector *(C1 *, CVector *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C1 *,CVector *>, 0,1>;
+META_END
+
+META_BEGIN(C1::SetName)
+static int address;
+static int global_address;
+static const int id = 0x402090;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x402090, 0, 0, 0, 0, 0>;
+// total references count: 10us (1), 10ushl (0), 10eu (0), 11us (0), 11eu (0), sr2 (0), sr2lv (0)
+using refs_t = RefList<0x402095,1001,1,0,0>;
+using def_t = void(C1 *, wchar_t *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C1 *,wchar_t *>, 0,1>;
+META_END
+
+META_BEGIN_OVERLOADED(C1::Update, int (*)(float))
+static int address;
+static int global_address;
+static const int id = 0x4020C0;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x4020C0, 0x4020E0, 0x4020F0, 0x402100, 0x402110, 0x402120>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x4020C5,1001,1,0,0, 0x4020C1,1002,1,0,0, 0x4020C2,1011,1,0,0, 0x4020C3,1101,1,0,0, 0x4020C4,1111,1,0,0, 0x4020C5,3200,1,0,0, 0x4020C6,3210,1,0,0>;
+using def_t = int(float);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<float>, 0>;
+META_END
+
+META_BEGIN_OVERLOADED(C1::Update, int (*)(float, int))
+static int address;
+static int global_address;
+static const int id = 0x4020F0;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x4020F0, 0x402110, 0x402120, 0x402130, 0x402140, 0x402150>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x4020F5,1001,1,0,0, 0x4020F1,1002,1,0,0, 0x4020F2,1011,1,0,0, 0x4020F3,1101,1,0,0, 0x4020F4,1111,1,0,0, 0x4020F5,3200,1,0,0, 0x4020F6,3210,1,0,0>;
+using def_t = int(float, int);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<float,int>, 0,1>;
+META_END
+
+META_BEGIN(C1::operator==)
+static int address;
+static int global_address;
+static const int id = 0x402120;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x402120, 0x402140, 0x402150, 0x402160, 0x402170, 0x402180>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x402125,1001,1,0,0, 0x402121,1002,1,0,0, 0x402122,1011,1,0,0, 0x402123,1101,1,0,0, 0x402124,1111,1,0,0, 0x402125,3200,1,0,0, 0x402126,3210,1,0,0>;
+using def_t = bool(C1 *, C1 &);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C1 *,C1 &>, 0,1>;
+META_END
+
+OP_NEW_META_BEGIN(C1)
+static int address;
+static int global_address;
+static const int id = 0x402150;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x402150, 0x402170, 0x402180, 0x402190, 0x4021A0, 0x4021B0>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x402155,1001,1,0,0, 0x402151,1002,1,0,0, 0x402152,1011,1,0,0, 0x402153,1101,1,0,0, 0x402154,1111,1,0,0, 0x402155,3200,1,0,0, 0x402156,3210,1,0,0>;
+using def_t = void *(unsigned int);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<unsigned int>, 0>;
+META_END
+
+META_BEGIN(GlobalFunc1)
+static int address;
+static int global_address;
+static const int id = 0x402180;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x402180, 0, 0, 0, 0, 0>;
+// total references count: 10us (1), 10ushl (0), 10eu (0), 11us (0), 11eu (0), sr2 (0), sr2lv (0)
+using refs_t = RefList<0x402185,1001,1,0,0>;
+using def_t = void(char const *, ...);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<char const *,...>, 0,1>;
+META_END
+
+}
@@ -0,0 +1,176 @@
+/*
+    Plugin-SDK (Grand Theft Auto San Andreas) header file
+    Authors: GTA Community. See more here
+    https://github.com/DK22Pac/plugin-sdk
+    Do not delete this comment block. Respect others' work!
+*/
+#include "PluginBase.h"
+
+namespace plugin {
+
+CTOR_META_BEGIN(C3)
+static int address;
+static int global_address;
+static const int id = 0x404030;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x404030, 0x404050, 0x404060, 0x404070, 0x404080, 0x404090>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x404035,1001,1,0,0, 0x404031,1002,1,0,0, 0x404032,1011,1,0,0, 0x404033,1101,1,0,0, 0x404034,1111,1,0,0, 0x404035,3200,1,0,0, 0x404036,3210,1,0,0>;
+using def_t = void(C3 *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C3 *>, 0>;
+META_END
+
+DTOR_META_BEGIN(C3)
+static int address;
+static int global_address;
+static const int id = 0x404060;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x404060, 0x404080, 0x404090, 0x4040A0, 0x4040B0, 0x4040C0>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x404065,1001,1,0,0, 0x404061,1002,1,0,0, 0x404062,1011,1,0,0, 0x404063,1101,1,0,0, 0x404064,1111,1,0,0, 0x404065,3200,1,0,0, 0x404066,3210,1,0,0>;
+using def_t = void(C3 *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C3 *>, 0>;
+META_END
+
+META_BEGIN(C3::Process)
+static int address;
+static int global_address;
+static const int id = 0x404090;
+static const bool is_virtual = true;
+static const int vtable_index = 1;
+using mv_addresses_t = MvAddresses<0x404090, 0, 0, 0, 0, 0>;
+// total references count: 10us (1), 10ushl (0), 10eu (0), 11us (0), 11eu (0), sr2 (0), sr2lv (0)
+using refs_t = RefList<0x404095,1001,1,0,0>;
+using def_t = void(C3 *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C3 *>, 0>;
+META_END
+
+META_BEGIN(C3::Render)
+static int address;
+static int global_address;
+static const int id = 0x4040C0;
+static const bool is_virtual = true;
+static const int vtable_index = 2;
+using mv_addresses_t = MvAddresses<0x4040C0, 0x4040E0, 0x4040F0, 0x404100, 0x404110, 0x404120>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x4040C5,1001,1,0,0, 0x4040C1,1002,1,0,0, 0x4040C2,1011,1,0,0, 0x4040C3,1101,1,0,0, 0x4040C4,1111,1,0,0, 0x4040C5,3200,1,0,0, 0x4040C6,3210,1,0,0>;
+using def_t = bool(C3 *, int);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C3 *,int>, 0,1>;
+META_END
+
+META_BEGIN(C3::GetPos)
+static int address;
+static int global_address;
+static const int id = 0x4040F0;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x4040F0, 0x404110, 0x404120, 0x404130, 0x404140, 0x404150>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x4040F5,1001,1,0,0, 0x4040F1,1002,1,0,0, 0x4040F2,1011,1,0,0, 0x4040F3,1101,1,0,0, 0x4040F4,1111,1,0,0, 0x4040F5,3200,1,0,0, 0x4040F6,3210,1,0,0>;
+using def_t = CVector *(C3 *, CVector *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C3 *,CVector *>, 0,1>;
+META_END
+
+META_BEGIN(C3::SetName)
+static int address;
+static int global_address;
+static const int id = 0x404120;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x404120, 0x404140, 0x404150, 0x404160, 0x404170, 0x404180>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x404125,1001,1,0,0, 0x404121,1002,1,0,0, 0x404122,1011,1,0,0, 0x404123,1101,1,0,0, 0x404124,1111,1,0,0, 0x404125,3200,1,0,0, 0x404126,3210,1,0,0>;
+using def_t = void(C3 *, wchar_t *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C3 *,wchar_t *>, 0,1>;
+META_END
+
+META_BEGIN_OVERLOADED(C3::Update, int (*)(float))
+static int address;
+static int global_address;
+static const int id = 0x404150;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x404150, 0x404170, 0x404180, 0x404190, 0x4041A0, 0x4041B0>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x404155,1001,1,0,0, 0x404151,1002,1,0,0, 0x404152,1011,1,0,0, 0x404153,1101,1,0,0, 0x404154,1111,1,0,0, 0x404155,3200,1,0,0, 0x404156,3210,1,0,0>;
+using def_t = int(float);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<float>, 0>;
+META_END
+
+META_BEGIN_OVERLOADED(C3::Update, int (*)(float, int))
+static int address;
+static int global_address;
+static const int id = 0x404180;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x404180, 0, 0, 0, 0, 0>;
+// total references count: 10us (1), 10ushl (0), 10eu (0), 11us (0), 11eu (0), sr2 (0), sr2lv (0)
+using refs_t = RefList<0x404185,1001,1,0,0>;
+using def_t = int(float, int);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<float,int>, 0,1>;
+META_END
+
+META_BEGIN(C3::operator==)
+static int address;
+static int global_address;
+static const int id = 0x4041B0;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x4041B0, 0x4041D0, 0x4041E0, 0x4041F0, 0x404200, 0x404210>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x4041B5,1001,1,0,0, 0x4041B1,1002,1,0,0, 0x4041B2,1011,1,0,0, 0x4041B3,1101,1,0,0, 0x4041B4,1111,1,0,0, 0x4041B5,3200,1,0,0, 0x4041B6,3210,1,0,0>;
+using def_t = bool(C3 *, C3 &);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C3 *,C3 &>, 0,1>;
+META_END
+
+OP_NEW_META_BEGIN(C3)
+static int address;
+static int global_address;
+static const int id = 0x4041E0;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x4041E0, 0x404200, 0x404210, 0x404220, 0x404230, 0x404240>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x4041E5,1001,1,0,0, 0x4041E1,1002,1,0,0, 0x4041E2,1011,1,0,0, 0x4041E3,1101,1,0,0, 0x4041E4,1111,1,0,0, 0x4041E5,3200,1,0,0, 0x4041E6,3210,1,0,0>;
+using def_t = void *(unsigned int);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<unsigned int>, 0>;
+META_END
+
+META_BEGIN(GlobalFunc3)
+static int address;
+static int global_address;
+static const int id = 0x404210;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x404210, 0x404230, 0x404240, 0x404250, 0x404260, 0x404270>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x404215,1001,1,0,0, 0x404211,1002,1,0,0, 0x404212,1011,1,0,0, 0x404213,1101,1,0,0, 0x404214,1111,1,0,0, 0x404215,3200,1,0,0, 0x404216,3210,1,0,0>;
+using def_t = void(char const *, ...);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<char const *,...>, 0,1>;
+META_END
+
+}
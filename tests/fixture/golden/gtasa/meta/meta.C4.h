@@ -0,0 +1,180 @@
+/*
+    Plugin-SDK (Grand Theft Auto San Andreas) header file
+    Authors: GTA Community. See more here
+    https://github.com/DK22Pac/plugin-sdk
+    Do not delete this comment block. Respect others' work!
+*/
+#include "PluginBase.h"
+
+namespace plugin {
+
+CTOR_META_BEGIN(C4)
+static int address;
+static int global_address;
+static const int id = 0x405030;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x405030, 0x405050, 0x405060, 0x405070, 0x405080, 0x405090>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x405035,1001,1,0,0, 0x405031,1002,1,0,0, 0x405032,1011,1,0,0, 0x405033,1101,1,0,0, 0x405034,1111,1,0,0, 0x405035,3200,1,0,0, 0x405036,3210,1,0,0>;
+using def_t = void(C4 *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C4 *>, 0>;
+META_END
+
+CTOR_META_BEGIN_OVERLOADED(C4, void(int, float))
+static int address;
+static int global_address;
+static const int id = 0x405060;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x405060, 0, 0, 0, 0, 0>;
+// total references count: 10us (1), 10ushl (0), 10eu (0), 11us (0), 11eu (0), sr2 (0), sr2lv (0)
+using refs_t = RefList<0x405065,1001,1,0,0>;
+using def_t = void(C4 *, int, float);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C4 *,int,float>, 0,1,2>;
+META_END
+
+META_BEGIN(C4::GetPos)
+static int address;
+static int global_address;
+static const int id = 0x405090;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x405090, 0x4050B0, 0x4050C0, 0x4050D0, 0x4050E0, 0x4050F0>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x405095,1001,1,0,0, 0x405091,1002,1,0,0, 0x405092,1011,1,0,0, 0x405093,1101,1,0,0, 0x405094,1111,1,0,0, 0x405095,3200,1,0,0, 0x405096,3210,1,0,0>;
+using def_t = CVector *(C4 *, CVector *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C4 *,CVector *>, 0,1>;
+META_END
+
+META_BEGIN(C4::SetName)
+static int address;
+static int global_address;
+static const int id = 0x4050C0;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x4050C0, 0x4050E0, 0x4050F0, 0x405100, 0x405110, 0x405120>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x4050C5,1001,1,0,0, 0x4050C1,1002,1,0,0, 0x4050C2,1011,1,0,0, 0x4050C3,1101,1,0,0, 0x4050C4,1111,1,0,0, 0x4050C5,3200,1,0,0, 0x4050C6,3210,1,0,0>;
+using def_t = void(C4 *, wchar_t *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C4 *,wchar_t *>, 0,1>;
+META_END
+
+META_BEGIN_OVERLOADED(C4::Update, int (*)(float))
+static int address;
+static int global_address;
+static const int id = 0x4050F0;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x4050F0, 0x405110, 0x405120, 0x405130, 0x405140, 0x405150>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x4050F5,1001,1,0,0, 0x4050F1,1002,1,0,0, 0x4050F2,1011,1,0,0, 0x4050F3,1101,1,0,0, 0x4050F4,1111,1,0,0, 0x4050F5,3200,1,0,0, 0x4050F6,3210,1,0,0>;
+using def_t = int(float);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<float>, 0>;
+META_END
+
+META_BEGIN_OVERLOADED(C4::Update, int (*)(float, int))
+static int address;
+static int global_address;
+static const int id = 0x405120;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x405120, 0x405140, 0x405150, 0x405160, 0x405170, 0x405180>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x405125,1001,1,0,0, 0x405121,1002,1,0,0, 0x405122,1011,1,0,0, 0x405123,1101,1,0,0, 0x405124,1111,1,0,0, 0x405125,3200,1,0,0, 0x405126,3210,1,0,0>;
+using def_t = int(float, int);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<float,int>, 0,1>;
+META_END
+
+META_BEGIN(C4::operator==)
+static int address;
+static int global_address;
+static const int id = 0x405150;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x405150, 0, 0, 0, 0, 0>;
+// total references count: 10us (1), 10ushl (0), 10eu (0), 11us (0), 11eu (0), sr2 (0), sr2lv (0)
+using refs_t = RefList<0x405155,1001,1,0,0>;
+using def_t = bool(C4 *, C4 &);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C4 *,C4 &>, 0,1>;
+META_END
+
+OP_NEW_META_BEGIN(C4)
+static int address;
+static int global_address;
+static const int id = 0x405180;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x405180, 0x4051A0, 0x4051B0, 0x4051C0, 0x4051D0, 0x4051E0>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x405185,1001,1,0,0, 0x405181,1002,1,0,0, 0x405182,1011,1,0,0, 0x405183,1101,1,0,0, 0x405184,1111,1,0,0, 0x405185,3200,1,0,0, 0x405186,3210,1,0,0>;
+using def_t = void *(unsigned int);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<unsigned int>, 0>;
+META_END
+
+META_BEGIN(GlobalFunc4)
+static int address;
+static int global_address;
+static const int id = 0x4051B0;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x4051B0, 0x4051D0, 0x4051E0, 0x4051F0, 0x405200, 0x405210>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x4051B5,1001,1,0,0, 0x4051B1,1002,1,0,0, 0x4051B2,1011,1,0,0, 0x4051B3,1101,1,0,0, 0x4051B4,1111,1,0,0, 0x4051B5,3200,1,0,0, 0x4051B6,3210,1,0,0>;
+using def_t = void(char const *, ...);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<char const *,...>, 0,1>;
+META_END
+
+template<>
+struct stack_object<C4> : stack_object_no_default<C4> {
+    SUPPORTED_10US_10EU_11US_11EU_SR2_SR2LV stack_object() {
+        plugin::CallMethodDynGlobal<C4 *>(ctor_gaddr(C4), reinterpret_cast<C4 *>(objBuff));
+    }
+    SUPPORTED_10US stack_object(int value, float f = 1.0f) {
+        plugin::CallMethodDynGlobal<C4 *, int, float>(ctor_gaddr_o(C4, void(int, float)), reinterpret_cast<C4 *>(objBuff), value, f);
+    }
+};
+
+template <>
+SUPPORTED_10US_10EU_11US_11EU_SR2_SR2LV inline C4 *operator_new<C4>() {
+    void *objData = plugin::CallAndReturnDynGlobal<void *, unsigned int>(op_new_gaddr(C4), sizeof(C4));
+    C4 *obj = reinterpret_cast<C4 *>(objData);
+    plugin::CallMethodDynGlobal<C4 *>(ctor_gaddr(C4), obj);
+    return obj;
+}
+template <>
+SUPPORTED_10US_10EU_11US_11EU_SR2_SR2LV inline C4 *operator_new_array<C4>(unsigned int objCount) {
+    void *objData = operator new(sizeof(C4) * objCount + 4); 
+    *reinterpret_cast<unsigned int *>(objData) = objCount;
+    C4 *objArray = reinterpret_cast<C4 *>(reinterpret_cast<unsigned int>(objData) + 4);
+    for (unsigned int i = 0; i < objCount; i++)
+        plugin::CallMethodDynGlobal<C4 *>(ctor_gaddr(C4), &objArray[i]);
+    return objArray;
+}
+template <>
+SUPPORTED_10US inline C4 *operator_new<C4>(int value, float f) {
+    void *objData = plugin::CallAndReturnDynGlobal<void *, unsigned int>(op_new_gaddr(C4), sizeof(C4));
+    C4 *obj = reinterpret_cast<C4 *>(objData);
+    plugin::CallMethodDynGlobal<C4 *, int, float>(ctor_gaddr_o(C4, void(int, float)), obj, value, f);
+    return obj;
+}
+
+}
@@ -0,0 +1,131 @@
+/*
+    Plugin-SDK (Grand Theft Auto San Andreas) header file
+    Authors: GTA Community. See more here
+    https://github.com/DK22Pac/plugin-sdk
+    Do not delete this comment block. Respect others' work!
+*/
+#include "PluginBase.h"
+
+namespace plugin {
+
+CTOR_META_BEGIN(C5)
+static int address;
+static int global_address;
+static const int id = 0x406030;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x406030, 0x406050, 0x406060, 0x406070, 0x406080, 0x406090>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x406035,1001,1,0,0, 0x406031,1002,1,0,0, 0x406032,1011,1,0,0, 0x406033,1101,1,0,0, 0x406034,1111,1,0,0, 0x406035,3200,1,0,0, 0x406036,3210,1,0,0>;
+using def_t = void(C5 *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C5 *>, 0>;
+META_END
+
+META_BEGIN(C5::GetPos)
+static int address;
+static int global_address;
+static const int id = 0x406060;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x406060, 0, 0, 0, 0, 0>;
+// total references count: 10us (1), 10ushl (0), 10eu (0), 11us (0), 11eu (0), sr2 (0), sr2lv (0)
+using refs_t = RefList<0x406065,1001,1,0,0>;
+using def_t = CVector *(C5 *, CVector *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C5 *,CVector *>, 0,1>;
+META_END
+
+META_BEGIN(C5::SetName)
+static int address;
+static int global_address;
+static const int id = 0x406090;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x406090, 0x4060B0, 0x4060C0, 0x4060D0, 0x4060E0, 0x4060F0>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x406095,1001,1,0,0, 0x406091,1002,1,0,0, 0x406092,1011,1,0,0, 0x406093,1101,1,0,0, 0x406094,1111,1,0,0, 0x406095,3200,1,0,0, 0x406096,3210,1,0,0>;
+using def_t = void(C5 *, wchar_t *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C5 *,wchar_t *>, 0,1>;
+META_END
+
+META_BEGIN_OVERLOADED(C5::Update, int (*)(float))
+static int address;
+static int global_address;
+static const int id = 0x4060C0;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x4060C0, 0x4060E0, 0x4060F0, 0x406100, 0x406110, 0x406120>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x4060C5,1001,1,0,0, 0x4060C1,1002,1,0,0, 0x4060C2,1011,1,0,0, 0x4060C3,1101,1,0,0, 0x4060C4,1111,1,0,0, 0x4060C5,3200,1,0,0, 0x4060C6,3210,1,0,0>;
+using def_t = int(float);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<float>, 0>;
+META_END
+
+META_BEGIN_OVERLOADED(C5::Update, int (*)(float, int))
+static int address;
+static int global_address;
+static const int id = 0x4060F0;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x4060F0, 0x406110, 0x406120, 0x406130, 0x406140, 0x406150>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x4060F5,1001,1,0,0, 0x4060F1,1002,1,0,0, 0x4060F2,1011,1,0,0, 0x4060F3,1101,1,0,0, 0x4060F4,1111,1,0,0, 0x4060F5,3200,1,0,0, 0x4060F6,3210,1,0,0>;
+using def_t = int(float, int);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<float,int>, 0,1>;
+META_END
+
+META_BEGIN(C5::operator==)
+static int address;
+static int global_address;
+static const int id = 0x406120;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x406120, 0x406140, 0x406150, 0x406160, 0x406170, 0x406180>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x406125,1001,1,0,0, 0x406121,1002,1,0,0, 0x406122,1011,1,0,0, 0x406123,1101,1,0,0, 0x406124,1111,1,0,0, 0x406125,3200,1,0,0, 0x406126,3210,1,0,0>;
+using def_t = bool(C5 *, C5 &);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C5 *,C5 &>, 0,1>;
+META_END
+
+OP_NEW_META_BEGIN(C5)
+static int address;
+static int global_address;
+static const int id = 0x406150;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x406150, 0, 0, 0, 0, 0>;
+// total references count: 10us (1), 10ushl (0), 10eu (0), 11us (0), 11eu (0), sr2 (0), sr2lv (0)
+using refs_t = RefList<0x406155,1001,1,0,0>;
+using def_t = void *(unsigned int);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<unsigned int>, 0>;
+META_END
+
+META_BEGIN(GlobalFunc5)
+static int address;
+static int global_address;
+static const int id = 0x406180;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x406180, 0x4061A0, 0x4061B0, 0x4061C0, 0x4061D0, 0x4061E0>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x406185,1001,1,0,0, 0x406181,1002,1,0,0, 0x406182,1011,1,0,0, 0x406183,1101,1,0,0, 0x406184,1111,1,0,0, 0x406185,3200,1,0,0, 0x406186,3210,1,0,0>;
+using def_t = void(char const *, ...);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<char const *,...>, 0,1>;
+META_END
+
+}
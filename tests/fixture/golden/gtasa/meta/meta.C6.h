@@ -0,0 +1,176 @@
+/*
+    Plugin-SDK (Grand Theft Auto San Andreas) header file
+    Authors: GTA Community. See more here
+    https://github.com/DK22Pac/plugin-sdk
+    Do not delete this comment block. Respect others' work!
+*/
+#include "PluginBase.h"
+
+namespace plugin {
+
+CTOR_META_BEGIN(C6)
+static int address;
+static int global_address;
+static const int id = 0x407030;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x407030, 0x407050, 0x407060, 0x407070, 0x407080, 0x407090>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x407035,1001,1,0,0, 0x407031,1002,1,0,0, 0x407032,1011,1,0,0, 0x407033,1101,1,0,0, 0x407034,1111,1,0,0, 0x407035,3200,1,0,0, 0x407036,3210,1,0,0>;
+using def_t = void(C6 *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C6 *>, 0>;
+META_END
+
+DTOR_META_BEGIN(C6)
+static int address;
+static int global_address;
+static const int id = 0x407060;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x407060, 0, 0, 0, 0, 0>;
+// total references count: 10us (1), 10ushl (0), 10eu (0), 11us (0), 11eu (0), sr2 (0), sr2lv (0)
+using refs_t = RefList<0x407065,1001,1,0,0>;
+using def_t = void(C6 *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C6 *>, 0>;
+META_END
+
+META_BEGIN(C6::Process)
+static int address;
+static int global_address;
+static const int id = 0x407090;
+static const bool is_virtual = true;
+static const int vtable_index = 1;
+using mv_addresses_t = MvAddresses<0x407090, 0x4070B0, 0x4070C0, 0x4070D0, 0x4070E0, 0x4070F0>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x407095,1001,1,0,0, 0x407091,1002,1,0,0, 0x407092,1011,1,0,0, 0x407093,1101,1,0,0, 0x407094,1111,1,0,0, 0x407095,3200,1,0,0, 0x407096,3210,1,0,0>;
+using def_t = void(C6 *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C6 *>, 0>;
+META_END
+
+META_BEGIN(C6::Render)
+static int address;
+static int global_address;
+static const int id = 0x4070C0;
+static const bool is_virtual = true;
+static const int vtable_index = 2;
+using mv_addresses_t = MvAddresses<0x4070C0, 0x4070E0, 0x4070F0, 0x407100, 0x407110, 0x407120>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x4070C5,1001,1,0,0, 0x4070C1,1002,1,0,0, 0x4070C2,1011,1,0,0, 0x4070C3,1101,1,0,0, 0x4070C4,1111,1,0,0, 0x4070C5,3200,1,0,0, 0x4070C6,3210,1,0,0>;
+using def_t = bool(C6 *, int);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C6 *,int>, 0,1>;
+META_END
+
+META_BEGIN(C6::GetPos)
+static int address;
+static int global_address;
+static const int id = 0x4070F0;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x4070F0, 0x407110, 0x407120, 0x407130, 0x407140, 0x407150>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x4070F5,1001,1,0,0, 0x4070F1,1002,1,0,0, 0x4070F2,1011,1,0,0, 0x4070F3,1101,1,0,0, 0x4070F4,1111,1,0,0, 0x4070F5,3200,1,0,0, 0x4070F6,3210,1,0,0>;
+using def_t = CVector *(C6 *, CVector *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C6 *,CVector *>, 0,1>;
+META_END
+
+META_BEGIN(C6::SetName)
+static int address;
+static int global_address;
+static const int id = 0x407120;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x407120, 0x407140, 0x407150, 0x407160, 0x407170, 0x407180>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x407125,1001,1,0,0, 0x407121,1002,1,0,0, 0x407122,1011,1,0,0, 0x407123,1101,1,0,0, 0x407124,1111,1,0,0, 0x407125,3200,1,0,0, 0x407126,3210,1,0,0>;
+using def_t = void(C6 *, wchar_t *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C6 *,wchar_t *>, 0,1>;
+META_END
+
+META_BEGIN_OVERLOADED(C6::Update, int (*)(float))
+static int address;
+static int global_address;
+static const int id = 0x407150;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x407150, 0, 0, 0, 0, 0>;
+// total references count: 10us (1), 10ushl (0), 10eu (0), 11us (0), 11eu (0), sr2 (0), sr2lv (0)
+using refs_t = RefList<0x407155,1001,1,0,0>;
+using def_t = int(float);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<float>, 0>;
+META_END
+
+META_BEGIN_OVERLOADED(C6::Update, int (*)(float, int))
+static int address;
+static int global_address;
+static const int id = 0x407180;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x407180, 0x4071A0, 0x4071B0, 0x4071C0, 0x4071D0, 0x4071E0>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x407185,1001,1,0,0, 0x407181,1002,1,0,0, 0x407182,1011,1,0,0, 0x407183,1101,1,0,0, 0x407184,1111,1,0,0, 0x407185,3200,1,0,0, 0x407186,3210,1,0,0>;
+using def_t = int(float, int);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<float,int>, 0,1>;
+META_END
+
+META_BEGIN(C6::operator==)
+static int address;
+static int global_address;
+static const int id = 0x4071B0;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x4071B0, 0x4071D0, 0x4071E0, 0x4071F0, 0x407200, 0x407210>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x4071B5,1001,1,0,0, 0x4071B1,1002,1,0,0, 0x4071B2,1011,1,0,0, 0x4071B3,1101,1,0,0, 0x4071B4,1111,1,0,0, 0x4071B5,3200,1,0,0, 0x4071B6,3210,1,0,0>;
+using def_t = bool(C6 *, C6 &);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C6 *,C6 &>, 0,1>;
+META_END
+
+OP_NEW_META_BEGIN(C6)
+static int address;
+static int global_address;
+static const int id = 0x4071E0;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x4071E0, 0x407200, 0x407210, 0x407220, 0x407230, 0x407240>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x4071E5,1001,1,0,0, 0x4071E1,1002,1,0,0, 0x4071E2,1011,1,0,0, 0x4071E3,1101,1,0,0, 0x4071E4,1111,1,0,0, 0x4071E5,3200,1,0,0, 0x4071E6,3210,1,0,0>;
+using def_t = void *(unsigned int);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<unsigned int>, 0>;
+META_END
+
+META_BEGIN(GlobalFunc6)
+static int address;
+static int global_address;
+static const int id = 0x407210;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x407210, 0x407230, 0x407240, 0x407250, 0x407260, 0x407270>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x407215,1001,1,0,0, 0x407211,1002,1,0,0, 0x407212,1011,1,0,0, 0x407213,1101,1,0,0, 0x407214,1111,1,0,0, 0x407215,3200,1,0,0, 0x407216,3210,1,0,0>;
+using def_t = void(char const *, ...);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<char const *,...>, 0,1>;
+META_END
+
+}
@@ -0,0 +1,155 @@
+/*
+    Plugin-SDK (Grand Theft Auto San Andreas) header file
+    Authors: GTA Community. See more here
+    https://github.com/DK22Pac/plugin-sdk
+    Do not delete this comment block. Respect others' work!
+*/
+#include "PluginBase.h"
+
+namespace plugin {
+
+CTOR_META_BEGIN(C7)
+static int address;
+static int global_address;
+static const int id = 0x408030;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x408030, 0, 0, 0, 0, 0>;
+// total references count: 10us (1), 10ushl (0), 10eu (0), 11us (0), 11eu (0), sr2 (0), sr2lv (0)
+using refs_t = RefList<0x408035,1001,1,0,0>;
+using def_t = void(C7 *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C7 *>, 0>;
+META_END
+
+META_BEGIN(C7::GetPos)
+static int address;
+static int global_address;
+static const int id = 0x408060;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x408060, 0x408080, 0x408090, 0x4080A0, 0x4080B0, 0x4080C0>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x408065,1001,1,0,0, 0x408061,1002,1,0,0, 0x408062,1011,1,0,0, 0x408063,1101,1,0,0, 0x408064,1111,1,0,0, 0x408065,3200,1,0,0, 0x408066,3210,1,0,0>;
+using def_t = CVector *(C7 *, CVector *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C7 *,CVector *>, 0,1>;
+META_END
+
+META_BEGIN(C7::SetName)
+static int address;
+static int global_address;
+static const int id = 0x408090;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x408090, 0x4080B0, 0x4080C0, 0x4080D0, 0x4080E0, 0x4080F0>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x408095,1001,1,0,0, 0x408091,1002,1,0,0, 0x408092,1011,1,0,0, 0x408093,1101,1,0,0, 0x408094,1111,1,0,0, 0x408095,3200,1,0,0, 0x408096,3210,1,0,0>;
+using def_t = void(C7 *, wchar_t *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C7 *,wchar_t *>, 0,1>;
+META_END
+
+META_BEGIN_OVERLOADED(C7::Update, int (*)(float))
+static int address;
+static int global_address;
+static const int id = 0x4080C0;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x4080C0, 0x4080E0, 0x4080F0, 0x408100, 0x408110, 0x408120>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x4080C5,1001,1,0,0, 0x4080C1,1002,1,0,0, 0x4080C2,1011,1,0,0, 0x4080C3,1101,1,0,0, 0x4080C4,1111,1,0,0, 0x4080C5,3200,1,0,0, 0x4080C6,3210,1,0,0>;
+using def_t = int(float);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<float>, 0>;
+META_END
+
+META_BEGIN_OVERLOADED(C7::Update, int (*)(float, int))
+static int address;
+static int global_address;
+static const int id = 0x4080F0;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x4080F0, 0x408110, 0x408120, 0x408130, 0x408140, 0x408150>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x4080F5,1001,1,0,0, 0x4080F1,1002,1,0,0, 0x4080F2,1011,1,0,0, 0x4080F3,1101,1,0,0, 0x4080F4,1111,1,0,0, 0x4080F5,3200,1,0,0, 0x4080F6,3210,1,0,0>;
+using def_t = int(float, int);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<float,int>, 0,1>;
+META_END
+
+META_BEGIN(C7::operator==)
+static int address;
+static int global_address;
+static const int id = 0x408120;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x408120, 0, 0, 0, 0, 0>;
+// total references count: 10us (1), 10ushl (0), 10eu (0), 11us (0), 11eu (0), sr2 (0), sr2lv (0)
+using refs_t = RefList<0x408125,1001,1,0,0>;
+using def_t = bool(C7 *, C7 &);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C7 *,C7 &>, 0,1>;
+META_END
+
+OP_NEW_META_BEGIN(C7)
+static int address;
+static int global_address;
+static const int id = 0x408150;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x408150, 0x408170, 0x408180, 0x408190, 0x4081A0, 0x4081B0>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x408155,1001,1,0,0, 0x408151,1002,1,0,0, 0x408152,1011,1,0,0, 0x408153,1101,1,0,0, 0x408154,1111,1,0,0, 0x408155,3200,1,0,0, 0x408156,3210,1,0,0>;
+using def_t = void *(unsigned int);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<unsigned int>, 0>;
+META_END
+
+META_BEGIN(GlobalFunc7)
+static int address;
+static int global_address;
+static const int id = 0x408180;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x408180, 0x4081A0, 0x4081B0, 0x4081C0, 0x4081D0, 0x4081E0>;
+// total references count: 10us (1), 10ushl (1), 10eu (1), 11us (1), 11eu (1), sr2 (1), sr2lv (1)
+using refs_t = RefList<0x408185,1001,1,0,0, 0x408181,1002,1,0,0, 0x408182,1011,1,0,0, 0x408183,1101,1,0,0, 0x408184,1111,1,0,0, 0x408185,3200,1,0,0, 0x408186,3210,1,0,0>;
+using def_t = void(char const *, ...);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<char const *,...>, 0,1>;
+META_END
+
+template<>
+struct stack_object<C7> : stack_object_no_default<C7> {
+    SUPPORTED_10US stack_object() {
+        plugin::CallMethodDynGlobal<C7 *>(ctor_gaddr(C7), reinterpret_cast<C7 *>(objBuff));
+    }
+};
+
+template <>
+SUPPORTED_10US inline C7 *operator_new<C7>() {
+    void *objData = plugin::CallAndReturnDynGlobal<void *, unsigned int>(op_new_gaddr(C7), sizeof(C7));
+    C7 *obj = reinterpret_cast<C7 *>(objData);
+    plugin::CallMethodDynGlobal<C7 *>(ctor_gaddr(C7), obj);
+    return obj;
+}
+template <>
+SUPPORTED_10US inline C7 *operator_new_array<C7>(unsigned int objCount) {
+    void *objData = operator new(sizeof(C7) * objCount + 4); 
+    *reinterpret_cast<unsigned int *>(objData) = objCount;
+    C7 *objArray = reinterpret_cast<C7 *>(reinterpret_cast<unsigned int>(objData) + 4);
+    for (unsigned int i = 0; i < objCount; i++)
+        plugin::CallMethodDynGlobal<C7 *>(ctor_gaddr(C7), &objArray[i]);
+    return objArray;
+}
+
+}
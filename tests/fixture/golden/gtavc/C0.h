@@ -0,0 +1,65 @@
+/*
+    Plugin-SDK (Grand Theft Auto Vice City) header file
+    Authors: GTA Community. See more here
+    https://github.com/DK22Pac/plugin-sdk
+    Do not delete this comment block. Respect others' work!
+*/
+#pragma once
+
+#include "PluginBase.h"
+#include "C3.h"
+#include "CVector.h"
+#include "CList.h"
+
+enum class PLUGIN_API eEnum0 : unsigned int {
+    E0_0 = 0,
+    E0_1 = 0x1, //!< c1
+    E0_2 = 0x2,
+    E0_3 = 0x3,
+    E0_4 = 0x4
+};
+
+//! class 0
+class PLUGIN_API C0 {
+    PLUGIN_NO_DEFAULT_CONSTRUCTION_VIRTUALBASE(C0)
+
+public:
+    class PLUGIN_API Inner {
+    public:
+        SUPPORTED_10EN_11EN_STEAM static C0 *&ms_x;
+    };
+
+    float m_fValue;
+    C3 *m_pNext;
+    CVector m_vec; //!< vector
+    CList<C0 *> m_list;
+    void(*m_cb)(int , C0 *);
+
+    //! counter
+    SUPPORTED_10EN_11EN_STEAM static int &ms_count;
+
+    SUPPORTED_10EN_11EN_STEAM bool operator==(C0 &other);
+
+    // virtual function #0 (not found)
+
+    SUPPORTED_10EN void Process();
+    SUPPORTED_10EN_11EN_STEAM bool Render(int mode);
+
+    // virtual function #3 (not found)
+
+
+    SUPPORTED_10EN_11EN_STEAM CVector GetPos();
+    SUPPORTED_10EN_11EN_STEAM void SetName(wchar_t *name);
+
+    SUPPORTED_10EN_11EN_STEAM static int Update(float dt);
+    SUPPORTED_10EN static int Update(float dt, int x);
+};
+
+SUPPORTED_10EN_11EN_STEAM extern float const(&g_array0)[4]; // float g_array0[4]
+
+SUPPORTED_10EN_11EN_STEAM void GlobalFunc0(char const *fmt, ... arg2);
+
+VTABLE_DESC(C0, 0x860000, 4);
+VALIDATE_SIZE(C0, 0x24);
+
+#include "meta/meta.C0.h"
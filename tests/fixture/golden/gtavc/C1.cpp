@@ -0,0 +1,63 @@
+/*
+    Plugin-SDK (Grand Theft Auto Vice City) source file
+    Authors: GTA Community. See more here
+    https://github.com/DK22Pac/plugin-sdk
+    Do not delete this comment block. Respect others' work!
+*/
+#include "C1.h"
+
+PLUGIN_SOURCE_FILE
+
+PLUGIN_VARIABLE C1 *&C1::Inner::ms_x = *reinterpret_cast<C1 **>(GLOBAL_ADDRESS_BY_VERSION(0xB00018, 0xB0001C, 0xB00020));
+PLUGIN_VARIABLE int &C1::ms_count = *reinterpret_cast<int *>(GLOBAL_ADDRESS_BY_VERSION(0xB00010, 0xB00014, 0xB00018));
+PLUGIN_VARIABLE float const(&g_array1)[4] = *reinterpret_cast<float const(*)[4]>(GLOBAL_ADDRESS_BY_VERSION(0xB00014, 0xB00018, 0xB0001C));
+
+int ctor_addr(C1) = ADDRESS_BY_VERSION(0x402030, 0x402040, 0x402050);
+int ctor_gaddr(C1) = GLOBAL_ADDRESS_BY_VERSION(0x402030, 0x402040, 0x402050);
+
+int op_new_addr(C1) = ADDRESS_BY_VERSION(0x402150, 0x402160, 0x402170);
+int op_new_gaddr(C1) = GLOBAL_ADDRESS_BY_VERSION(0x402150, 0x402160, 0x402170);
+
+int addrof(C1::operator==) = ADDRESS_BY_VERSION(0x402120, 0x402130, 0x402140);
+int gaddrof(C1::operator==) = GLOBAL_ADDRESS_BY_VERSION(0x402120, 0x402130, 0x402140);
+
+bool C1::operator==(C1 &other) {
+    return plugin::CallMethodAndReturnDynGlobal<bool, C1 *, C1 &>(gaddrof(C1::operator==), this, other);
+}
+
+int addrof(C1::GetPos) = ADDRESS_BY_VERSION(0x402060, 0x402070, 0x402080);
+int gaddrof(C1::GetPos) = GLOBAL_ADDRESS_BY_VERSION(0x402060, 0x402070, 0x402080);
+
+CVector C1::GetPos() {
+    CVector ret_out;
+    plugin::CallMethodDynGlobal<C1 *, CVector *>(gaddrof(C1::GetPos), this, &ret_out);
+    return ret_out;
+}
+
+int addrof(C1::SetName) = ADDRESS_BY_VERSION(0x402090, 0, 0);
+int gaddrof(C1::SetName) = GLOBAL_ADDRESS_BY_VERSION(0x402090, 0, 0);
+
+void C1::SetName(wchar_t *name) {
+    plugin::CallMethodDynGlobal<C1 *, wchar_t *>(gaddrof(C1::SetName), this, name);
+}
+
+int addrof_o(C1::Update, int (*)(float)) = ADDRESS_BY_VERSION(0x4020C0, 0x4020D0, 0x4020E0);
+int gaddrof_o(C1::Update, int (*)(float)) = GLOBAL_ADDRESS_BY_VERSION(0x4020C0, 0x4020D0, 0x4020E0);
+
+int C1::Update(float dt) {
+    return plugin::CallAndReturnDynGlobal<int, float>(gaddrof_o(C1::Update, int (*)(float)), dt);
+}
+
+int addrof_o(C1::Update, int (*)(float, int)) = ADDRESS_BY_VERSION(0x4020F0, 0x402100, 0x402110);
+int gaddrof_o(C1::Update, int (*)(float, int)) = GLOBAL_ADDRESS_BY_VERSION(0x4020F0, 0x402100, 0x402110);
+
+int C1::Update(float dt, int x) {
+    return plugin::CallAndReturnDynGlobal<int, float, int>(gaddrof_o(C1::Update, int (*)(float, int)), dt, x);
+}
+
+int addrof(GlobalFunc1) = ADDRESS_BY_VERSION(0x402180, 0, 0);
+int gaddrof(GlobalFunc1) = GLOBAL_ADDRESS_BY_VERSION(0x402180, 0, 0);
+
+void GlobalFunc1(char const *fmt, ... arg2) {
+    plugin::CallDynGlobal<char const *, ...>(gaddrof(GlobalFunc1), fmt, arg2);
+}
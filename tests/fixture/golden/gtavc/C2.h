@@ -0,0 +1,54 @@
+/*
+    Plugin-SDK (Grand Theft Auto Vice City) header file
+    Authors: GTA Community. See more here
+    https://github.com/DK22Pac/plugin-sdk
+    Do not delete this comment block. Respect others' work!
+*/
+#pragma once
+
+#include "PluginBase.h"
+#include "C1.h"
+#include "CVector.h"
+#include "CList.h"
+
+class C0;
+
+//! class 2
+class PLUGIN_API C2 : public C0 {
+    PLUGIN_NO_DEFAULT_CONSTRUCTION(C2)
+
+public:
+    struct PLUGIN_API Nested {
+        int x;
+    };
+    class PLUGIN_API Inner {
+    public:
+        SUPPORTED_10EN_11EN_STEAM static C2 *&ms_x;
+    };
+
+    float m_fValue;
+    C1 *m_pNext;
+    CVector m_vec; //!< vector
+    CList<C1 *> m_list;
+    void(*m_cb)(int , C2 *);
+
+    //! counter
+    SUPPORTED_10EN_11EN_STEAM static int &ms_count;
+
+    SUPPORTED_10EN_11EN_STEAM bool operator==(C2 &other);
+
+    SUPPORTED_10EN_11EN_STEAM CVector GetPos();
+    SUPPORTED_10EN void SetName(wchar_t *name);
+
+    SUPPORTED_10EN_11EN_STEAM static int Update(float dt);
+    SUPPORTED_10EN_11EN_STEAM static int Update(float dt, int x);
+};
+
+SUPPORTED_10EN_11EN_STEAM extern float const(&g_array2)[4]; // float g_array2[4]
+
+SUPPORTED_10EN void GlobalFunc2(char const *fmt, ... arg2);
+
+VALIDATE_SIZE(C2::Nested, 0x4);
+VALIDATE_SIZE(C2, 0x28);
+
+#include "meta/meta.C2.h"
@@ -0,0 +1,59 @@
+/*
+    Plugin-SDK (Grand Theft Auto Vice City) header file
+    Authors: GTA Community. See more here
+    https://github.com/DK22Pac/plugin-sdk
+    Do not delete this comment block. Respect others' work!
+*/
+#pragma once
+
+#include "PluginBase.h"
+#include "C1.h"
+#include "C6.h"
+#include "CVector.h"
+#include "CList.h"
+
+//! class 3
+struct PLUGIN_API C3 : public C1 {
+private:
+    PLUGIN_NO_DEFAULT_CONSTRUCTION(C3)
+
+public:
+    class PLUGIN_API Inner {
+    public:
+        SUPPORTED_10EN_11EN_STEAM static C3 *&ms_x;
+    };
+
+    float m_fValue;
+    C6 *m_pNext;
+    CVector m_vec; //!< vector
+    CList<C1 *> m_list;
+    void(*m_cb)(int , C3 *);
+
+    //! counter
+    SUPPORTED_10EN_11EN_STEAM static int &ms_count;
+
+    SUPPORTED_10EN_11EN_STEAM bool operator==(C3 &other);
+
+    // virtual function #0 (not overriden)
+
+    SUPPORTED_10EN void Process();
+    SUPPORTED_10EN_11EN_STEAM bool Render(int mode);
+
+    // virtual function #3 (not overriden)
+
+
+    SUPPORTED_10EN_11EN_STEAM CVector GetPos();
+    SUPPORTED_10EN_11EN_STEAM void SetName(wchar_t *name);
+
+    SUPPORTED_10EN_11EN_STEAM static int Update(float dt);
+    SUPPORTED_10EN static int Update(float dt, int x);
+};
+
+SUPPORTED_10EN_11EN_STEAM extern float const(&g_array3)[4]; // float g_array3[4]
+
+SUPPORTED_10EN_11EN_STEAM void GlobalFunc3(char const *fmt, ... arg2);
+
+VTABLE_DESC(C3, 0x860030, 4);
+VALIDATE_SIZE(C3, 0x28);
+
+#include "meta/meta.C3.h"
@@ -0,0 +1,58 @@
+/*
+    Plugin-SDK (Grand Theft Auto Vice City) header file
+    Authors: GTA Community. See more here
+    https://github.com/DK22Pac/plugin-sdk
+    Do not delete this comment block. Respect others' work!
+*/
+#pragma once
+
+#include "PluginBase.h"
+#include "C1.h"
+#include "C6.h"
+#include "CVector.h"
+#include "CList.h"
+#include "C2.h"
+
+enum PLUGIN_API eEnum1 : unsigned int {
+    E1_0 = 0,
+    E1_1 = 1, //!< c1
+    E1_2 = 2,
+    E1_3 = 3,
+    E1_4 = 4
+};
+
+//! class 4
+class PLUGIN_API C4 : public C1 {
+    PLUGIN_NO_DEFAULT_CONSTRUCTION(C4)
+
+public:
+    class PLUGIN_API Inner {
+    public:
+        SUPPORTED_10EN_11EN_STEAM static C4 *&ms_x;
+    };
+
+    float m_fValue;
+    C6 *m_pNext;
+    CVector m_vec; //!< vector
+    CList<C2 *> m_list;
+    void(*m_cb)(int , C4 *);
+
+    //! counter
+    SUPPORTED_10EN_11EN_STEAM static int &ms_count;
+
+    SUPPORTED_10EN bool operator==(C4 &other);
+
+    SUPPORTED_10EN_11EN_STEAM CVector GetPos();
+    SUPPORTED_10EN_11EN_STEAM void SetName(wchar_t *name);
+
+    SUPPORTED_10EN_11EN_STEAM static int Update(float dt);
+    SUPPORTED_10EN_11EN_STEAM static int Update(float dt, int x);
+};
+
+SUPPORTED_10EN_11EN_STEAM extern float const(&g_array4)[4]; // float g_array4[4]
+
+SUPPORTED_10EN_11EN_STEAM void GlobalFunc4(char const *fmt, ... arg2);
+
+VALIDATE_SIZE(C4, 0x28);
+
+#include "meta/meta.C4.h"
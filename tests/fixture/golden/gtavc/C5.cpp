@@ -0,0 +1,71 @@
+/*
+    Plugin-SDK (Grand Theft Auto Vice City) source file
+    Authors: GTA Community. See more here
+    https://github.com/DK22Pac/plugin-sdk
+    Do not delete this comment block. Respect others' work!
+*/
+#include "C5.h"
+
+PLUGIN_SOURCE_FILE
+
+PLUGIN_VARIABLE C5 *&C5::Inner::ms_x = *reinterpret_cast<C5 **>(GLOBAL_ADDRESS_BY_VERSION(0xB00058, 0xB0005C, 0xB00060));
+PLUGIN_VARIABLE int &C5::ms_count = *reinterpret_cast<int *>(GLOBAL_ADDRESS_BY_VERSION(0xB00050, 0xB00054, 0xB00058));
+PLUGIN_VARIABLE float const(&g_array5)[4] = *reinterpret_cast<float const(*)[4]>(GLOBAL_ADDRESS_BY_VERSION(0xB00054, 0xB00058, 0xB0005C));
+
+int ctor_addr(C5) = ADDRESS_BY_VERSION(0x406030, 0x406040, 0x406050);
+int ctor_gaddr(C5) = GLOBAL_ADDRESS_BY_VERSION(0x406030, 0x406040, 0x406050);
+
+C5::C5() {
+    plugin::CallMethodDynGlobal<C5 *>(ctor_gaddr(C5), this);
+}
+
+int op_new_addr(C5) = ADDRESS_BY_VERSION(0x406150, 0, 0);
+int op_new_gaddr(C5) = GLOBAL_ADDRESS_BY_VERSION(0x406150, 0, 0);
+
+void *C5::operator new(unsigned int size) {
+    return plugin::CallAndReturnDynGlobal<void *, unsigned int>(op_new_gaddr(C5), size);
+}
+
+int addrof(C5::operator==) = ADDRESS_BY_VERSION(0x406120, 0x406130, 0x406140);
+int gaddrof(C5::operator==) = GLOBAL_ADDRESS_BY_VERSION(0x406120, 0x406130, 0x406140);
+
+bool C5::operator==(C5 &other) {
+    return plugin::CallMethodAndReturnDynGlobal<bool, C5 *, C5 &>(gaddrof(C5::operator==), this, other);
+}
+
+int addrof(C5::GetPos) = ADDRESS_BY_VERSION(0x406060, 0, 0);
+int gaddrof(C5::GetPos) = GLOBAL_ADDRESS_BY_VERSION(0x406060, 0, 0);
+
+CVector C5::GetPos() {
+    CVector ret_out;
+    plugin::CallMethodDynGlobal<C5 *, CVector *>(gaddrof(C5::GetPos), this, &ret_out);
+    return ret_out;
+}
+
+int addrof(C5::SetName) = ADDRESS_BY_VERSION(0x406090, 0x4060A0, 0x4060B0);
+int gaddrof(C5::SetName) = GLOBAL_ADDRESS_BY_VERSION(0x406090, 0x4060A0, 0x4060B0);
+
+void C5::SetName(wchar_t *name) {
+    plugin::CallMethodDynGlobal<C5 *, wchar_t *>(gaddrof(C5::SetName), this, name);
+}
+
+int addrof_o(C5::Update, int (*)(float)) = ADDRESS_BY_VERSION(0x4060C0, 0x4060D0, 0x4060E0);
+int gaddrof_o(C5::Update, int (*)(float)) = GLOBAL_ADDRESS_BY_VERSION(0x4060C0, 0x4060D0, 0x4060E0);
+
+int C5::Update(float dt) {
+    return plugin::CallAndReturnDynGlobal<int, float>(gaddrof_o(C5::Update, int (*)(float)), dt);
+}
+
+int addrof_o(C5::Update, int (*)(float, int)) = ADDRESS_BY_VERSION(0x4060F0, 0x406100, 0x406110);
+int gaddrof_o(C5::Update, int (*)(float, int)) = GLOBAL_ADDRESS_BY_VERSION(0x4060F0, 0x406100, 0x406110);
+
+int C5::Update(float dt, int x) {
+    return plugin::CallAndReturnDynGlobal<int, float, int>(gaddrof_o(C5::Update, int (*)(float, int)), dt, x);
+}
+
+int addrof(GlobalFunc5) = ADDRESS_BY_VERSION(0x406180, 0x406190, 0x4061A0);
+int gaddrof(GlobalFunc5) = GLOBAL_ADDRESS_BY_VERSION(0x406180, 0x406190, 0x4061A0);
+
+void GlobalFunc5(char const *fmt, ... arg2) {
+    plugin::CallDynGlobal<char const *, ...>(gaddrof(GlobalFunc5), fmt, arg2);
+}
@@ -0,0 +1,50 @@
+/*
+    Plugin-SDK (Grand Theft Auto Vice City) header file
+    Authors: GTA Community. See more here
+    https://github.com/DK22Pac/plugin-sdk
+    Do not delete this comment block. Respect others' work!
+*/
+#pragma once
+
+#include "PluginBase.h"
+#include "C2.h"
+#include "C1.h"
+#include "CVector.h"
+#include "CList.h"
+
+//! class 5
+struct PLUGIN_API C5 : public C2 {
+    class PLUGIN_API Inner {
+    public:
+        SUPPORTED_10EN_11EN_STEAM static C5 *&ms_x;
+    };
+
+    float m_fValue;
+    C1 *m_pNext;
+    CVector m_vec; //!< vector
+    CList<C2 *> m_list;
+    void(*m_cb)(int , C5 *);
+
+    //! counter
+    SUPPORTED_10EN_11EN_STEAM static int &ms_count;
+
+    SUPPORTED_10EN_11EN_STEAM C5();
+
+    SUPPORTED_10EN static void *operator new(unsigned int size);
+
+    SUPPORTED_10EN_11EN_STEAM bool operator==(C5 &other);
+
+    SUPPORTED_10EN CVector GetPos();
+    SUPPORTED_10EN_11EN_STEAM void SetName(wchar_t *name);
+
+    SUPPORTED_10EN_11EN_STEAM static int Update(float dt);
+    SUPPORTED_10EN_11EN_STEAM static int Update(float dt, int x);
+};
+
+SUPPORTED_10EN_11EN_STEAM extern float const(&g_array5)[4]; // float g_array5[4]
+
+SUPPORTED_10EN_11EN_STEAM void GlobalFunc5(char const *fmt, ... arg2);
+
+VALIDATE_SIZE(C5, 0x28);
+
+#include "meta/meta.C5.h"
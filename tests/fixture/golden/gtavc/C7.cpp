@@ -0,0 +1,63 @@
+/*
+    Plugin-SDK (Grand Theft Auto Vice City) source file
+    Authors: GTA Community. See more here
+    https://github.com/DK22Pac/plugin-sdk
+    Do not delete this comment block. Respect others' work!
+*/
+#include "C7.h"
+
+PLUGIN_SOURCE_FILE
+
+PLUGIN_VARIABLE C7 *&C7::Inner::ms_x = *reinterpret_cast<C7 **>(GLOBAL_ADDRESS_BY_VERSION(0xB00078, 0xB0007C, 0xB00080));
+PLUGIN_VARIABLE int &C7::ms_count = *reinterpret_cast<int *>(GLOBAL_ADDRESS_BY_VERSION(0xB00070, 0xB00074, 0xB00078));
+PLUGIN_VARIABLE float const(&g_array7)[4] = *reinterpret_cast<float const(*)[4]>(GLOBAL_ADDRESS_BY_VERSION(0xB00074, 0xB00078, 0xB0007C));
+
+int ctor_addr(C7) = ADDRESS_BY_VERSION(0x408030, 0, 0);
+int ctor_gaddr(C7) = GLOBAL_ADDRESS_BY_VERSION(0x408030, 0, 0);
+
+int op_new_addr(C7) = ADDRESS_BY_VERSION(0x408150, 0x408160, 0x408170);
+int op_new_gaddr(C7) = GLOBAL_ADDRESS_BY_VERSION(0x408150, 0x408160, 0x408170);
+
+int addrof(C7::operator==) = ADDRESS_BY_VERSION(0x408120, 0, 0);
+int gaddrof(C7::operator==) = GLOBAL_ADDRESS_BY_VERSION(0x408120, 0, 0);
+
+bool C7::operator==(C7 &other) {
+    return plugin::CallMethodAndReturnDynGlobal<bool, C7 *, C7 &>(gaddrof(C7::operator==), this, other);
+}
+
+int addrof(C7::GetPos) = ADDRESS_BY_VERSION(0x408060, 0x408070, 0x408080);
+int gaddrof(C7::GetPos) = GLOBAL_ADDRESS_BY_VERSION(0x408060, 0x408070, 0x408080);
+
+CVector C7::GetPos() {
+    CVector ret_out;
+    plugin::CallMethodDynGlobal<C7 *, CVector *>(gaddrof(C7::GetPos), this, &ret_out);
+    return ret_out;
+}
+
+int addrof(C7::SetName) = ADDRESS_BY_VERSION(0x408090, 0x4080A0, 0x4080B0);
+int gaddrof(C7::SetName) = GLOBAL_ADDRESS_BY_VERSION(0x408090, 0x4080A0, 0x4080B0);
+
+void C7::SetName(wchar_t *name) {
+    plugin::CallMethodDynGlobal<C7 *, wchar_t *>(gaddrof(C7::SetName), this, name);
+}
+
+int addrof_o(C7::Update, int (*)(float)) = ADDRESS_BY_VERSION(0x4080C0, 0x4080D0, 0x4080E0);
+int gaddrof_o(C7::Update, int (*)(float)) = GLOBAL_ADDRESS_BY_VERSION(0x4080C0, 0x4080D0, 0x4080E0);
+
+int C7::Update(float dt) {
+    return plugin::CallAndReturnDynGlobal<int, float>(gaddrof_o(C7::Update, int (*)(float)), dt);
+}
+
+int addrof_o(C7::Update, int (*)(float, int)) = ADDRESS_BY_VERSION(0x4080F0, 0x408100, 0x408110);
+int gaddrof_o(C7::Update, int (*)(float, int)) = GLOBAL_ADDRESS_BY_VERSION(0x4080F0, 0x408100, 0x408110);
+
+int C7::Update(float dt, int x) {
+    return plugin::CallAndReturnDynGlobal<int, float, int>(gaddrof_o(C7::Update, int (*)(float, int)), dt, x);
+}
+
+int addrof(GlobalFunc7) = ADDRESS_BY_VERSION(0x408180, 0x408190, 0x4081A0);
+int gaddrof(GlobalFunc7) = GLOBAL_ADDRESS_BY_VERSION(0x408180, 0x408190, 0x4081A0);
+
+void GlobalFunc7(char const *fmt, ... arg2) {
+    plugin::CallDynGlobal<char const *, ...>(gaddrof(GlobalFunc7), fmt, arg2);
+}
@@ -0,0 +1,52 @@
+/*
+    Plugin-SDK (Grand Theft Auto Vice City) header file
+    Authors: GTA Community. See more here
+    https://github.com/DK22Pac/plugin-sdk
+    Do not delete this comment block. Respect others' work!
+*/
+#pragma once
+
+#include "PluginBase.h"
+#include "C3.h"
+#include "C1.h"
+#include "C4.h"
+#include "CVector.h"
+#include "CList.h"
+
+//! class 7
+struct PLUGIN_API C7 : public C3 {
+private:
+    PLUGIN_NO_DEFAULT_CONSTRUCTION(C7)
+
+public:
+    class PLUGIN_API Inner {
+    public:
+        SUPPORTED_10EN_11EN_STEAM static C7 *&ms_x;
+    };
+
+    float m_fValue;
+    C1 *m_pNext;
+    C4 m_inner;
+    CVector m_vec; //!< vector
+    CList<C3 *> m_list;
+    void(*m_cb)(int , C7 *);
+
+    //! counter
+    SUPPORTED_10EN_11EN_STEAM static int &ms_count;
+
+    SUPPORTED_10EN bool operator==(C7 &other);
+
+    SUPPORTED_10EN_11EN_STEAM CVector GetPos();
+    SUPPORTED_10EN_11EN_STEAM void SetName(wchar_t *name);
+
+    SUPPORTED_10EN_11EN_STEAM static int Update(float dt);
+    SUPPORTED_10EN_11EN_STEAM static int Update(float dt, int x);
+};
+
+SUPPORTED_10EN_11EN_STEAM extern float const(&g_array7)[4]; // float g_array7[4]
+
+SUPPORTED_10EN_11EN_STEAM void GlobalFunc7(char const *fmt, ... arg2);
+
+VALIDATE_SIZE(C7, 0x38);
+
+#include "meta/meta.C7.h"
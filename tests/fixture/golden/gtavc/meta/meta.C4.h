@@ -0,0 +1,180 @@
+/*
+    Plugin-SDK (Grand Theft Auto Vice City) header file
+    Authors: GTA Community. See more here
+    https://github.com/DK22Pac/plugin-sdk
+    Do not delete this comment block. Respect others' work!
+*/
+#include "PluginBase.h"
+
+namespace plugin {
+
+CTOR_META_BEGIN(C4)
+static int address;
+static int global_address;
+static const int id = 0x405030;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x405030, 0x405040, 0x405050>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x405035,100,1,0,0, 0x405031,110,1,0,0, 0x405032,120,1,0,0>;
+using def_t = void(C4 *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C4 *>, 0>;
+META_END
+
+CTOR_META_BEGIN_OVERLOADED(C4, void(int, float))
+static int address;
+static int global_address;
+static const int id = 0x405060;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x405060, 0, 0>;
+// total references count: 10en (1), 11en (0), steam (0)
+using refs_t = RefList<0x405065,100,1,0,0>;
+using def_t = void(C4 *, int, float);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C4 *,int,float>, 0,1,2>;
+META_END
+
+META_BEGIN(C4::GetPos)
+static int address;
+static int global_address;
+static const int id = 0x405090;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x405090, 0x4050A0, 0x4050B0>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x405095,100,1,0,0, 0x405091,110,1,0,0, 0x405092,120,1,0,0>;
+using def_t = CVector *(C4 *, CVector *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C4 *,CVector *>, 0,1>;
+META_END
+
+META_BEGIN(C4::SetName)
+static int address;
+static int global_address;
+static const int id = 0x4050C0;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x4050C0, 0x4050D0, 0x4050E0>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x4050C5,100,1,0,0, 0x4050C1,110,1,0,0, 0x4050C2,120,1,0,0>;
+using def_t = void(C4 *, wchar_t *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C4 *,wchar_t *>, 0,1>;
+META_END
+
+META_BEGIN_OVERLOADED(C4::Update, int (*)(float))
+static int address;
+static int global_address;
+static const int id = 0x4050F0;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x4050F0, 0x405100, 0x405110>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x4050F5,100,1,0,0, 0x4050F1,110,1,0,0, 0x4050F2,120,1,0,0>;
+using def_t = int(float);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<float>, 0>;
+META_END
+
+META_BEGIN_OVERLOADED(C4::Update, int (*)(float, int))
+static int address;
+static int global_address;
+static const int id = 0x405120;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x405120, 0x405130, 0x405140>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x405125,100,1,0,0, 0x405121,110,1,0,0, 0x405122,120,1,0,0>;
+using def_t = int(float, int);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<float,int>, 0,1>;
+META_END
+
+META_BEGIN(C4::operator==)
+static int address;
+static int global_address;
+static const int id = 0x405150;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x405150, 0, 0>;
+// total references count: 10en (1), 11en (0), steam (0)
+using refs_t = RefList<0x405155,100,1,0,0>;
+using def_t = bool(C4 *, C4 &);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C4 *,C4 &>, 0,1>;
+META_END
+
+OP_NEW_META_BEGIN(C4)
+static int address;
+static int global_address;
+static const int id = 0x405180;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x405180, 0x405190, 0x4051A0>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x405185,100,1,0,0, 0x405181,110,1,0,0, 0x405182,120,1,0,0>;
+using def_t = void *(unsigned int);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<unsigned int>, 0>;
+META_END
+
+META_BEGIN(GlobalFunc4)
+static int address;
+static int global_address;
+static const int id = 0x4051B0;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x4051B0, 0x4051C0, 0x4051D0>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x4051B5,100,1,0,0, 0x4051B1,110,1,0,0, 0x4051B2,120,1,0,0>;
+using def_t = void(char const *, ...);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<char const *,...>, 0,1>;
+META_END
+
+template<>
+struct stack_object<C4> : stack_object_no_default<C4> {
+    SUPPORTED_10EN_11EN_STEAM stack_object() {
+        plugin::CallMethodDynGlobal<C4 *>(ctor_gaddr(C4), reinterpret_cast<C4 *>(objBuff));
+    }
+    SUPPORTED_10EN stack_object(int value, float f = 1.0f) {
+        plugin::CallMethodDynGlobal<C4 *, int, float>(ctor_gaddr_o(C4, void(int, float)), reinterpret_cast<C4 *>(objBuff), value, f);
+    }
+};
+
+template <>
+SUPPORTED_10EN_11EN_STEAM inline C4 *operator_new<C4>() {
+    void *objData = plugin::CallAndReturnDynGlobal<void *, unsigned int>(op_new_gaddr(C4), sizeof(C4));
+    C4 *obj = reinterpret_cast<C4 *>(objData);
+    plugin::CallMethodDynGlobal<C4 *>(ctor_gaddr(C4), obj);
+    return obj;
+}
+template <>
+SUPPORTED_10EN_11EN_STEAM inline C4 *operator_new_array<C4>(unsigned int objCount) {
+    void *objData = operator new(sizeof(C4) * objCount + 4); 
+    *reinterpret_cast<unsigned int *>(objData) = objCount;
+    C4 *objArray = reinterpret_cast<C4 *>(reinterpret_cast<unsigned int>(objData) + 4);
+    for (unsigned int i = 0; i < objCount; i++)
+        plugin::CallMethodDynGlobal<C4 *>(ctor_gaddr(C4), &objArray[i]);
+    return objArray;
+}
+template <>
+SUPPORTED_10EN inline C4 *operator_new<C4>(int value, float f) {
+    void *objData = plugin::CallAndReturnDynGlobal<void *, unsigned int>(op_new_gaddr(C4), sizeof(C4));
+    C4 *obj = reinterpret_cast<C4 *>(objData);
+    plugin::CallMethodDynGlobal<C4 *, int, float>(ctor_gaddr_o(C4, void(int, float)), obj, value, f);
+    return obj;
+}
+
+}
@@ -0,0 +1,176 @@
+/*
+    Plugin-SDK (Grand Theft Auto Vice City) header file
+    Authors: GTA Community. See more here
+    https://github.com/DK22Pac/plugin-sdk
+    Do not delete this comment block. Respect others' work!
+*/
+#include "PluginBase.h"
+
+namespace plugin {
+
+CTOR_META_BEGIN(C6)
+static int address;
+static int global_address;
+static const int id = 0x407030;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x407030, 0x407040, 0x407050>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x407035,100,1,0,0, 0x407031,110,1,0,0, 0x407032,120,1,0,0>;
+using def_t = void(C6 *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C6 *>, 0>;
+META_END
+
+DTOR_META_BEGIN(C6)
+static int address;
+static int global_address;
+static const int id = 0x407060;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x407060, 0, 0>;
+// total references count: 10en (1), 11en (0), steam (0)
+using refs_t = RefList<0x407065,100,1,0,0>;
+using def_t = void(C6 *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C6 *>, 0>;
+META_END
+
+META_BEGIN(C6::Process)
+static int address;
+static int global_address;
+static const int id = 0x407090;
+static const bool is_virtual = true;
+static const int vtable_index = 1;
+using mv_addresses_t = MvAddresses<0x407090, 0x4070A0, 0x4070B0>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x407095,100,1,0,0, 0x407091,110,1,0,0, 0x407092,120,1,0,0>;
+using def_t = void(C6 *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C6 *>, 0>;
+META_END
+
+META_BEGIN(C6::Render)
+static int address;
+static int global_address;
+static const int id = 0x4070C0;
+static const bool is_virtual = true;
+static const int vtable_index = 2;
+using mv_addresses_t = MvAddresses<0x4070C0, 0x4070D0, 0x4070E0>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x4070C5,100,1,0,0, 0x4070C1,110,1,0,0, 0x4070C2,120,1,0,0>;
+using def_t = bool(C6 *, int);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C6 *,int>, 0,1>;
+META_END
+
+META_BEGIN(C6::GetPos)
+static int address;
+static int global_address;
+static const int id = 0x4070F0;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x4070F0, 0x407100, 0x407110>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x4070F5,100,1,0,0, 0x4070F1,110,1,0,0, 0x4070F2,120,1,0,0>;
+using def_t = CVector *(C6 *, CVector *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C6 *,CVector *>, 0,1>;
+META_END
+
+META_BEGIN(C6::SetName)
+static int address;
+static int global_address;
+static const int id = 0x407120;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x407120, 0x407130, 0x407140>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x407125,100,1,0,0, 0x407121,110,1,0,0, 0x407122,120,1,0,0>;
+using def_t = void(C6 *, wchar_t *);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C6 *,wchar_t *>, 0,1>;
+META_END
+
+META_BEGIN_OVERLOADED(C6::Update, int (*)(float))
+static int address;
+static int global_address;
+static const int id = 0x407150;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x407150, 0, 0>;
+// total references count: 10en (1), 11en (0), steam (0)
+using refs_t = RefList<0x407155,100,1,0,0>;
+using def_t = int(float);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<float>, 0>;
+META_END
+
+META_BEGIN_OVERLOADED(C6::Update, int (*)(float, int))
+static int address;
+static int global_address;
+static const int id = 0x407180;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x407180, 0x407190, 0x4071A0>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x407185,100,1,0,0, 0x407181,110,1,0,0, 0x407182,120,1,0,0>;
+using def_t = int(float, int);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<float,int>, 0,1>;
+META_END
+
+META_BEGIN(C6::operator==)
+static int address;
+static int global_address;
+static const int id = 0x4071B0;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x4071B0, 0x4071C0, 0x4071D0>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x4071B5,100,1,0,0, 0x4071B1,110,1,0,0, 0x4071B2,120,1,0,0>;
+using def_t = bool(C6 *, C6 &);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Thiscall;
+using args_t = ArgPick<ArgTypes<C6 *,C6 &>, 0,1>;
+META_END
+
+OP_NEW_META_BEGIN(C6)
+static int address;
+static int global_address;
+static const int id = 0x4071E0;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x4071E0, 0x4071F0, 0x407200>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x4071E5,100,1,0,0, 0x4071E1,110,1,0,0, 0x4071E2,120,1,0,0>;
+using def_t = void *(unsigned int);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<unsigned int>, 0>;
+META_END
+
+META_BEGIN(GlobalFunc6)
+static int address;
+static int global_address;
+static const int id = 0x407210;
+static const bool is_virtual = false;
+static const int vtable_index = -1;
+using mv_addresses_t = MvAddresses<0x407210, 0x407220, 0x407230>;
+// total references count: 10en (1), 11en (1), steam (1)
+using refs_t = RefList<0x407215,100,1,0,0, 0x407211,110,1,0,0, 0x407212,120,1,0,0>;
+using def_t = void(char const *, ...);
+static const int cb_priority = PRIORITY_AFTER; 
+using calling_convention_t = CallingConventions::Cdecl;
+using args_t = ArgPick<ArgTypes<char const *,...>, 0,1>;
+META_END
+
+}
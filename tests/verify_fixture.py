@@ -0,0 +1,155 @@
+"""Checks plugin-sdk-source-gen against the fixture database.
+
+usage:
+    python tests/verify_fixture.py <path to plugin-sdk-source-gen executable>
+
+The fixture (tests/fixture/database) is copied to a temporary plugin-sdk folder and generated with
+--verify tests/fixture/golden in each mode below. Modes which use files from a previous run
+(--snapshot, --incremental) get a normal run first.
+Incremental generation is also checked after database edits (EDITS): the output of --incremental
+after the edit must be the same as the output of a full run on the edited database.
+
+To update the golden output after an intended change in generated code, run the generator on a copy
+of the fixture database and replace tests/fixture/golden with its generated/modules folder.
+"""
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+TESTS_DIR = os.path.dirname(os.path.abspath(__file__))
+FIXTURE_DATABASE = os.path.join(TESTS_DIR, 'fixture', 'database')
+FIXTURE_GOLDEN = os.path.join(TESTS_DIR, 'fixture', 'golden')
+
+# name, options for a normal run before the check (None - no run), options for --verify run
+MODES = [
+    ('default', None, []),
+    ('jobs 0', None, ['--jobs', '0']),
+    ('pipeline', None, ['--pipeline']),
+    ('snapshot', ['--snapshot'], ['--snapshot']),
+    ('incremental', [], ['--incremental']),
+]
+
+
+def move_pure_virtual_override(sdk):
+    # C3::Render moves to vtable entry #3, which is empty in the base classes C1 and C0 (other modules),
+    # and changes its return type; C0 and C1 must be written again
+    for game in ('gta3', 'gtavc', 'gtasa'):
+        folder = os.path.join(sdk, 'database', game)
+        for name in os.listdir(folder):
+            if not (name.startswith('plugin-sdk.') and '.functions.' in name):
+                continue
+            filepath = os.path.join(folder, name)
+            with open(filepath, newline='') as f:
+                lines = f.read().split('\n')
+            if not lines[0].startswith(('10us,', '10en,')):
+                continue
+            for i, line in enumerate(lines):
+                if ',C3::Render,' in line:
+                    fields = line.split(',')
+                    fields[6] = 'int'  # RetType
+                    fields[12] = '3'  # VTableIndex
+                    lines[i] = ','.join(fields)
+            with open(filepath, 'w', newline='') as f:
+                f.write('\n'.join(lines))
+
+
+# name, function which edits the database of given plugin-sdk folder
+EDITS = [
+    ('incremental after moving pure virtual override', move_pure_virtual_override),
+]
+
+
+def run(generator, sdk, options):
+    result = subprocess.run([generator, sdk] + options, stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                            universal_newlines=True)
+    return result.returncode, result.stdout
+
+
+def make_sdk(root, name):
+    sdk = os.path.join(root, name.replace(' ', '_'))
+    shutil.copytree(FIXTURE_DATABASE, os.path.join(sdk, 'database'))
+    return sdk
+
+
+def check_mode(generator, root, name, prepare, options):
+    sdk = make_sdk(root, name)
+    if prepare is not None:
+        code, output = run(generator, sdk, prepare)
+        if code != 0:
+            print(output)
+            print('FAILED: %s (preparation run exited with %d)' % (name, code))
+            return False
+    code, output = run(generator, sdk, ['--verify', FIXTURE_GOLDEN] + options)
+    summary = [line for line in output.splitlines() if line.startswith(('Verify:', 'DIFFERENT:', 'MISSING:', 'UNEXPECTED:'))]
+    if code != 0:
+        print('\n'.join(summary) if summary else output)
+        print('FAILED: %s' % name)
+        return False
+    print('OK: %s (%s)' % (name, summary[-1] if summary else ''))
+    return True
+
+
+def read_files(folder):
+    files = {}
+    for dirpath, dirnames, filenames in os.walk(folder):
+        for name in filenames:
+            filepath = os.path.join(dirpath, name)
+            with open(filepath, 'rb') as f:
+                files[os.path.relpath(filepath, folder)] = f.read()
+    return files
+
+
+def check_edit(generator, root, name, edit):
+    incremental_sdk = make_sdk(root, name)
+    full_sdk = make_sdk(root, name + ' full')
+    for sdk, options in ((incremental_sdk, []), (full_sdk, None)):
+        if options is not None:
+            code, output = run(generator, sdk, options)
+            if code != 0:
+                print(output)
+                print('FAILED: %s (preparation run exited with %d)' % (name, code))
+                return False
+        edit(sdk)
+    for sdk, options in ((incremental_sdk, ['--incremental']), (full_sdk, [])):
+        code, output = run(generator, sdk, options)
+        if code != 0:
+            print(output)
+            print('FAILED: %s (exited with %d)' % (name, code))
+            return False
+    incremental_files = read_files(os.path.join(incremental_sdk, 'generated', 'modules'))
+    full_files = read_files(os.path.join(full_sdk, 'generated', 'modules'))
+    different = sorted(p for p in set(incremental_files) | set(full_files) if incremental_files.get(p) != full_files.get(p))
+    if different:
+        for p in different:
+            print('DIFFERENT: %s' % p)
+        print('FAILED: %s' % name)
+        return False
+    print('OK: %s (%d files same as full run)' % (name, len(full_files)))
+    return True
+
+
+def main():
+    if len(sys.argv) < 2:
+        print(__doc__)
+        return 1
+    generator = os.path.abspath(sys.argv[1])
+    root = tempfile.mkdtemp(prefix='plugin-sdk-fixture-')
+    try:
+        numFailed = 0
+        for name, prepare, options in MODES:
+            if not check_mode(generator, root, name, prepare, options):
+                numFailed += 1
+        for name, edit in EDITS:
+            if not check_edit(generator, root, name, edit):
+                numFailed += 1
+    finally:
+        shutil.rmtree(root, ignore_errors=True)
+    numChecks = len(MODES) + len(EDITS)
+    print('%d of %d checks failed' % (numFailed, numChecks) if numFailed else 'All %d checks passed' % numChecks)
+    return 1 if numFailed else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())